@@ -0,0 +1,196 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/intrinsics/exceptions.hpp"
+#include "armcortex/intrinsics/exclusive.hpp"
+#include <cstdint>
+#include <type_traits>
+
+namespace ArmCortex {
+    //! Atomic integer usable between thread code and interrupt handlers.
+    //! Read-modify-write operations are lock-free LDREX/STREX retry loops on ARMv7-M and
+    //! short PRIMASK critical sections on ARMv6-M, so no libatomic calls are generated.
+    //! \note Operations order memory accesses for the compiler only. Use asmDmb() in addition
+    //!       when ordering against other bus masters (e.g. DMA) matters.
+    //! \tparam T 8-, 16- or 32-bit integral type.
+    template<typename T>
+    class Atomic {
+        static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>, "Atomic requires an integral type.");
+        static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4, "Atomic supports 8-, 16- and 32-bit types only.");
+
+    public:
+        constexpr Atomic() = default;
+
+        constexpr Atomic(T initial_value) :
+            m_value(initial_value)
+        {
+        }
+
+        Atomic(const Atomic&) = delete;
+        Atomic& operator=(const Atomic&) = delete;
+
+        //! Atomically read the value.
+        [[gnu::always_inline]] inline T load() const
+        {
+            compilerBarrier();
+            T value = m_value;
+            compilerBarrier();
+            return value;
+        }
+
+        //! Atomically write the value.
+        [[gnu::always_inline]] inline void store(T new_value)
+        {
+            compilerBarrier();
+            m_value = new_value;
+            compilerBarrier();
+        }
+
+        //! Atomically replace the value.
+        //! \return Previous value.
+        [[gnu::always_inline]] inline T exchange(T new_value)
+        {
+            return fetchModify([new_value](T) { return new_value; });
+        }
+
+        //! Atomically add to the value.
+        //! \return Previous value.
+        [[gnu::always_inline]] inline T fetchAdd(T operand)
+        {
+            return fetchModify([operand](T old_value) { return static_cast<T>(old_value + operand); });
+        }
+
+        //! Atomically subtract from the value.
+        //! \return Previous value.
+        [[gnu::always_inline]] inline T fetchSub(T operand)
+        {
+            return fetchModify([operand](T old_value) { return static_cast<T>(old_value - operand); });
+        }
+
+        //! Atomically AND the value with a mask.
+        //! \return Previous value.
+        [[gnu::always_inline]] inline T fetchAnd(T mask)
+        {
+            return fetchModify([mask](T old_value) { return static_cast<T>(old_value & mask); });
+        }
+
+        //! Atomically OR the value with a mask.
+        //! \return Previous value.
+        [[gnu::always_inline]] inline T fetchOr(T mask)
+        {
+            return fetchModify([mask](T old_value) { return static_cast<T>(old_value | mask); });
+        }
+
+        //! Atomically replace the value if it equals the expected one.
+        //! \param expected Expected value, updated with the current value on failure.
+        //! \param desired Value to store on success.
+        //! \return True if the value was replaced.
+        [[gnu::always_inline]] inline bool compareExchange(T& expected, T desired)
+        {
+#if defined(__ARM_FEATURE_LDREX)
+            do {
+                T current = loadExclusive();
+
+                if (current != expected) {
+                    asmClrex();
+                    expected = current;
+                    return false;
+                }
+            } while (storeExclusive(desired) != 0);
+
+            return true;
+#else
+            uint32_t primask = disableInterrupts();
+            T current = m_value;
+            bool success = (current == expected);
+
+            if (success) {
+                m_value = desired;
+            } else {
+                expected = current;
+            }
+
+            restoreInterrupts(primask);
+            return success;
+#endif
+        }
+
+    private:
+        volatile T m_value = 0;
+
+        template<typename Operation>
+        [[gnu::always_inline]] inline T fetchModify(Operation operation)
+        {
+#if defined(__ARM_FEATURE_LDREX)
+            T old_value;
+
+            do {
+                old_value = loadExclusive();
+            } while (storeExclusive(operation(old_value)) != 0);
+
+            return old_value;
+#else
+            uint32_t primask = disableInterrupts();
+            T old_value = m_value;
+            m_value = operation(old_value);
+            restoreInterrupts(primask);
+            return old_value;
+#endif
+        }
+
+#if defined(__ARM_FEATURE_LDREX)
+        [[gnu::always_inline]] inline T loadExclusive()
+        {
+            if constexpr (sizeof(T) == 1) {
+                return static_cast<T>(asmLdrexb(reinterpret_cast<volatile uint8_t*>(&m_value)));
+            } else if constexpr (sizeof(T) == 2) {
+                return static_cast<T>(asmLdrexh(reinterpret_cast<volatile uint16_t*>(&m_value)));
+            } else {
+                return static_cast<T>(asmLdrex(reinterpret_cast<volatile uint32_t*>(&m_value)));
+            }
+        }
+
+        [[gnu::always_inline]] inline uint32_t storeExclusive(T new_value)
+        {
+            if constexpr (sizeof(T) == 1) {
+                return asmStrexb(static_cast<uint8_t>(new_value), reinterpret_cast<volatile uint8_t*>(&m_value));
+            } else if constexpr (sizeof(T) == 2) {
+                return asmStrexh(static_cast<uint16_t>(new_value), reinterpret_cast<volatile uint16_t*>(&m_value));
+            } else {
+                return asmStrex(static_cast<uint32_t>(new_value), reinterpret_cast<volatile uint32_t*>(&m_value));
+            }
+        }
+#else
+        //! Save PRIMASK and disable interrupts.
+        [[gnu::always_inline]] static inline uint32_t disableInterrupts()
+        {
+            uint32_t primask;
+            asm volatile("MRS %0, PRIMASK" : "=r" (primask) : : "memory");
+            asmCpsid();
+            return primask;
+        }
+
+        //! Restore the PRIMASK saved by disableInterrupts().
+        [[gnu::always_inline]] static inline void restoreInterrupts(uint32_t primask)
+        {
+            asm volatile("MSR PRIMASK, %0" : : "r" (primask) : "memory");
+        }
+#endif
+    };
+}
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <concepts>
+#include <type_traits>
 
 namespace ArmCortex {
     //! Check if the n-th bit is set in the value.
@@ -40,4 +41,249 @@ namespace ArmCortex {
     {
         value &= ~(T{1} << n);
     }
+
+    //! Mask with the listed bits set, computed at compile time.
+    template<uint8_t... bits>
+    [[gnu::always_inline]] constexpr uint32_t maskOf()
+    {
+        static_assert(((bits < 32) && ...), "Bit number must be in range 0-31.");
+        return (0u | ... | (uint32_t{1} << bits));
+    }
+
+    //! Sets all listed bits in the value with a single OR.
+    template<uint8_t... bits, std::integral T>
+    [[gnu::always_inline]] constexpr void setBits(T& value)
+    {
+        static_assert(((bits < sizeof(T) * 8) && ...), "Bit number exceeds the value width.");
+        value |= static_cast<T>(maskOf<bits...>());
+    }
+
+    //! Clears all listed bits in the value with a single AND-NOT.
+    template<uint8_t... bits, std::integral T>
+    [[gnu::always_inline]] constexpr void clearBits(T& value)
+    {
+        static_assert(((bits < sizeof(T) * 8) && ...), "Bit number exceeds the value width.");
+        value &= static_cast<T>(~maskOf<bits...>());
+    }
+
+    //! Replaces the bits selected by mask with the corresponding bits of new_bits.
+    template<std::integral T>
+    [[gnu::always_inline]] constexpr void assignBits(T& value, T mask, T new_bits)
+    {
+        value = static_cast<T>((value & ~mask) | (new_bits & mask));
+    }
+
+    //! Mask of width bits starting at bit pos.
+    template<std::unsigned_integral T, uint8_t pos, uint8_t width>
+    inline constexpr T FIELD_MASK = static_cast<T>(
+        (width >= 32 ? 0xFFFFFFFFu : ((uint32_t{1} << (width % 32)) - 1u)) << pos
+    );
+
+    //! Extracts the unsigned field of width bits starting at bit pos.
+    //! Compiles to UBFX on ARMv7-M and a LSLS/LSRS pair on ARMv6-M.
+    template<uint8_t pos, uint8_t width, std::unsigned_integral T>
+    [[gnu::always_inline]] constexpr T extractField(T value)
+    {
+        static_assert(sizeof(T) <= sizeof(uint32_t), "Field helpers support up to 32-bit values.");
+        static_assert(width > 0 && pos + width <= sizeof(T) * 8, "Field does not fit into the value.");
+        return static_cast<T>((value & FIELD_MASK<T, pos, width>) >> pos);
+    }
+
+    //! Extracts the field of width bits starting at bit pos and sign-extends it.
+    //! Compiles to SBFX on ARMv7-M and a LSLS/ASRS pair on ARMv6-M.
+    template<uint8_t pos, uint8_t width, std::unsigned_integral T>
+    [[gnu::always_inline]] constexpr std::make_signed_t<T> extractSignedField(T value)
+    {
+        static_assert(sizeof(T) <= sizeof(uint32_t), "Field helpers support up to 32-bit values.");
+        static_assert(width > 0 && pos + width <= sizeof(T) * 8, "Field does not fit into the value.");
+        int32_t field = static_cast<int32_t>(static_cast<uint32_t>(value) << (32 - pos - width)) >> (32 - width);
+        return static_cast<std::make_signed_t<T>>(field);
+    }
+
+    //! Replaces the field of width bits starting at bit pos with the low width bits of field.
+    //! Compiles to BFI on ARMv7-M.
+    template<uint8_t pos, uint8_t width, std::unsigned_integral T>
+    [[gnu::always_inline]] constexpr void insertField(T& value, T field)
+    {
+        static_assert(sizeof(T) <= sizeof(uint32_t), "Field helpers support up to 32-bit values.");
+        static_assert(width > 0 && pos + width <= sizeof(T) * 8, "Field does not fit into the value.");
+        value = static_cast<T>((value & ~FIELD_MASK<T, pos, width>) | ((field << pos) & FIELD_MASK<T, pos, width>));
+    }
+
+    //! Replaces the field of width bits starting at bit pos with a two's complement value.
+    template<uint8_t pos, uint8_t width, std::unsigned_integral T>
+    [[gnu::always_inline]] constexpr void insertSignedField(T& value, std::make_signed_t<T> field)
+    {
+        insertField<pos, width>(value, static_cast<T>(field));
+    }
+
+    //! Clears the field of width bits starting at bit pos.
+    //! Compiles to BFC or BIC on ARMv7-M.
+    template<uint8_t pos, uint8_t width, std::unsigned_integral T>
+    [[gnu::always_inline]] constexpr void clearField(T& value)
+    {
+        static_assert(sizeof(T) <= sizeof(uint32_t), "Field helpers support up to 32-bit values.");
+        static_assert(width > 0 && pos + width <= sizeof(T) * 8, "Field does not fit into the value.");
+        value = static_cast<T>(value & ~FIELD_MASK<T, pos, width>);
+    }
+
+    //! Portable implementations of the bit intrinsics below.
+    //! Used in constant expressions and on cores without the corresponding instruction.
+    namespace Portable {
+        //! Leading zero count indexed by de Bruijn hash of a value with all bits below its MSB set.
+        inline constexpr uint8_t CLZ_DE_BRUIJN_TABLE[32] = {
+            31, 22, 30, 21, 18, 10, 29, 2, 20, 17, 15, 13, 9, 6, 28, 1, 23, 19, 11, 3, 16, 14, 7, 24, 12, 4, 8, 25, 5, 26, 27, 0
+        };
+
+        //! Trailing zero count indexed by de Bruijn hash of a value with a single bit set.
+        inline constexpr uint8_t CTZ_DE_BRUIJN_TABLE[32] = {
+            0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8, 31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+        };
+
+        [[gnu::always_inline]] constexpr uint32_t countLeadingZeros(uint32_t value)
+        {
+            if (value == 0) {
+                return 32;
+            }
+
+            value |= value >> 1;
+            value |= value >> 2;
+            value |= value >> 4;
+            value |= value >> 8;
+            value |= value >> 16;
+            return CLZ_DE_BRUIJN_TABLE[(value * 0x07C4ACDDu) >> 27];
+        }
+
+        [[gnu::always_inline]] constexpr uint32_t countTrailingZeros(uint32_t value)
+        {
+            if (value == 0) {
+                return 32;
+            }
+
+            return CTZ_DE_BRUIJN_TABLE[((value & (0u - value)) * 0x077CB531u) >> 27];
+        }
+
+        [[gnu::always_inline]] constexpr uint32_t byteSwap32(uint32_t value)
+        {
+            return (value >> 24) | ((value >> 8) & 0x0000FF00u) | ((value << 8) & 0x00FF0000u) | (value << 24);
+        }
+
+        [[gnu::always_inline]] constexpr uint32_t reverseBits(uint32_t value)
+        {
+            value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+            value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+            value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+            return byteSwap32(value);
+        }
+
+        [[gnu::always_inline]] constexpr uint16_t byteSwap16(uint16_t value)
+        {
+            return static_cast<uint16_t>((value >> 8) | (value << 8));
+        }
+    }
+
+    //! Count leading zero bits.
+    //! Single CLZ instruction on ARMv7-M, de Bruijn multiply and table lookup on ARMv6-M.
+    //! \return Number of zero bits above the most significant set bit, 32 if value is 0.
+    [[gnu::always_inline]] constexpr uint32_t countLeadingZeros(uint32_t value)
+    {
+#if defined(__ARM_FEATURE_CLZ)
+        if (!std::is_constant_evaluated()) {
+            uint32_t result;
+            asm("clz %0, %1" : "=r" (result) : "r" (value));
+            return result;
+        }
+#endif
+        return Portable::countLeadingZeros(value);
+    }
+
+    //! Count trailing zero bits.
+    //! RBIT and CLZ on ARMv7-M, de Bruijn multiply and table lookup on ARMv6-M.
+    //! \return Number of zero bits below the least significant set bit, 32 if value is 0.
+    [[gnu::always_inline]] constexpr uint32_t countTrailingZeros(uint32_t value)
+    {
+#if defined(__ARM_FEATURE_CLZ)
+        if (!std::is_constant_evaluated()) {
+            uint32_t result;
+            asm("rbit %0, %1\n\t"
+                "clz %0, %0"
+                : "=r" (result) : "r" (value));
+            return result;
+        }
+#endif
+        return Portable::countTrailingZeros(value);
+    }
+
+    //! Find first set bit.
+    //! \return One-based position of the least significant set bit, 0 if value is 0.
+    [[gnu::always_inline]] constexpr uint32_t findFirstSet(uint32_t value)
+    {
+        return 32 - countLeadingZeros(value & (0u - value));
+    }
+
+    //! Count set bits.
+    //! Branch-free SWAR sum, Cortex-M has no population count instruction.
+    [[gnu::always_inline]] constexpr uint32_t populationCount(uint32_t value)
+    {
+        value = value - ((value >> 1) & 0x55555555u);
+        value = (value & 0x33333333u) + ((value >> 2) & 0x33333333u);
+        value = (value + (value >> 4)) & 0x0F0F0F0Fu;
+        return (value * 0x01010101u) >> 24;
+    }
+
+    //! Reverse the bit order of a word.
+    //! Single RBIT instruction on ARMv7-M.
+    [[gnu::always_inline]] constexpr uint32_t reverseBits(uint32_t value)
+    {
+#if defined(__ARM_FEATURE_CLZ)
+        if (!std::is_constant_evaluated()) {
+            uint32_t result;
+            asm("rbit %0, %1" : "=r" (result) : "r" (value));
+            return result;
+        }
+#endif
+        return Portable::reverseBits(value);
+    }
+
+    //! Reverse the byte order of a word.
+    //! Single REV instruction.
+    [[gnu::always_inline]] constexpr uint32_t byteSwap32(uint32_t value)
+    {
+#if defined(__ARM_ARCH)
+        if (!std::is_constant_evaluated()) {
+            uint32_t result;
+            asm("rev %0, %1" : "=l" (result) : "l" (value));
+            return result;
+        }
+#endif
+        return Portable::byteSwap32(value);
+    }
+
+    //! Reverse the byte order of a halfword.
+    //! Single REV16 instruction.
+    [[gnu::always_inline]] constexpr uint16_t byteSwap16(uint16_t value)
+    {
+#if defined(__ARM_ARCH)
+        if (!std::is_constant_evaluated()) {
+            uint32_t result;
+            asm("rev16 %0, %1" : "=l" (result) : "l" (static_cast<uint32_t>(value)));
+            return static_cast<uint16_t>(result);
+        }
+#endif
+        return Portable::byteSwap16(value);
+    }
+
+    //! Reverse the byte order of a signed halfword and sign-extend the result.
+    //! Single REVSH instruction.
+    [[gnu::always_inline]] constexpr int16_t byteSwapSigned16(int16_t value)
+    {
+#if defined(__ARM_ARCH)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("revsh %0, %1" : "=l" (result) : "l" (static_cast<int32_t>(value)));
+            return static_cast<int16_t>(result);
+        }
+#endif
+        return static_cast<int16_t>(Portable::byteSwap16(static_cast<uint16_t>(value)));
+    }
 }
@@ -0,0 +1,238 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/bit_utils.hpp"
+#include <cstdint>
+#include <initializer_list>
+
+namespace ArmCortex {
+    //! Fixed-size set of bits stored in 32-bit words.
+    //! Intended for ready queues and interrupt masks: searches skip whole empty words and use
+    //! CLZ/RBIT on ARMv7-M (de Bruijn lookups on ARMv6-M) within a word.
+    //! \tparam N Number of bits.
+    template<uint32_t N>
+    class BitSet {
+        static_assert(N > 0, "BitSet must contain at least one bit.");
+
+    public:
+        static constexpr uint32_t SIZE = N; //!< Number of bits.
+        static constexpr uint32_t WORD_COUNT = (N + 31) / 32; //!< Number of 32-bit words.
+        static constexpr uint32_t NOT_FOUND = N; //!< Returned by the find functions when no bit is set.
+
+        //! Iterator over the indices of set bits, in ascending order.
+        class Iterator {
+        public:
+            constexpr Iterator(const BitSet& bit_set, uint32_t index) :
+                m_bit_set(bit_set),
+                m_index(index)
+            {
+            }
+
+            constexpr uint32_t operator*() const
+            {
+                return m_index;
+            }
+
+            constexpr Iterator& operator++()
+            {
+                m_index = m_bit_set.findNext(m_index + 1);
+                return *this;
+            }
+
+            constexpr bool operator!=(const Iterator& other) const
+            {
+                return m_index != other.m_index;
+            }
+
+        private:
+            const BitSet& m_bit_set;
+            uint32_t m_index;
+        };
+
+        constexpr BitSet() = default;
+
+        //! Construct with the listed bits set.
+        constexpr BitSet(std::initializer_list<uint32_t> set_bits)
+        {
+            for (uint32_t n : set_bits) {
+                set(n);
+            }
+        }
+
+        constexpr void set(uint32_t n)
+        {
+            m_words[n / 32] |= uint32_t{1} << (n % 32);
+        }
+
+        constexpr void clear(uint32_t n)
+        {
+            m_words[n / 32] &= ~(uint32_t{1} << (n % 32));
+        }
+
+        constexpr void assign(uint32_t n, bool state)
+        {
+            if (state) {
+                set(n);
+            } else {
+                clear(n);
+            }
+        }
+
+        constexpr bool test(uint32_t n) const
+        {
+            return (m_words[n / 32] >> (n % 32)) & 1u;
+        }
+
+        //! Set all N bits.
+        constexpr void setAll()
+        {
+            for (uint32_t i = 0; i < WORD_COUNT; ++i) {
+                m_words[i] = 0xFFFFFFFFu;
+            }
+
+            m_words[WORD_COUNT - 1] &= LAST_WORD_MASK;
+        }
+
+        constexpr void clearAll()
+        {
+            for (uint32_t i = 0; i < WORD_COUNT; ++i) {
+                m_words[i] = 0;
+            }
+        }
+
+        //! Word i of the set, bit n is bit (n % 32) of word (n / 32).
+        constexpr uint32_t word(uint32_t i) const
+        {
+            return m_words[i];
+        }
+
+        //! Replace word i of the set, e.g. with a pending-interrupt register value.
+        constexpr void setWord(uint32_t i, uint32_t value)
+        {
+            m_words[i] = (i == WORD_COUNT - 1) ? (value & LAST_WORD_MASK) : value;
+        }
+
+        //! Number of set bits.
+        constexpr uint32_t count() const
+        {
+            uint32_t total = 0;
+
+            for (uint32_t i = 0; i < WORD_COUNT; ++i) {
+                total += populationCount(m_words[i]);
+            }
+
+            return total;
+        }
+
+        constexpr bool any() const
+        {
+            for (uint32_t i = 0; i < WORD_COUNT; ++i) {
+                if (m_words[i] != 0) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        constexpr bool none() const
+        {
+            return !any();
+        }
+
+        //! Index of the lowest set bit, NOT_FOUND if none is set.
+        constexpr uint32_t findFirst() const
+        {
+            for (uint32_t i = 0; i < WORD_COUNT; ++i) {
+                if (m_words[i] != 0) {
+                    return (i * 32) + countTrailingZeros(m_words[i]);
+                }
+            }
+
+            return NOT_FOUND;
+        }
+
+        //! Index of the highest set bit, NOT_FOUND if none is set.
+        constexpr uint32_t findLast() const
+        {
+            for (uint32_t i = WORD_COUNT; i > 0; --i) {
+                if (m_words[i - 1] != 0) {
+                    return (i * 32) - 1 - countLeadingZeros(m_words[i - 1]);
+                }
+            }
+
+            return NOT_FOUND;
+        }
+
+        //! Index of the lowest set bit at or above n, NOT_FOUND if none is set.
+        constexpr uint32_t findNext(uint32_t n) const
+        {
+            if (n >= N) {
+                return NOT_FOUND;
+            }
+
+            uint32_t i = n / 32;
+            uint32_t remaining = m_words[i] & (0xFFFFFFFFu << (n % 32));
+
+            while (remaining == 0) {
+                if (++i == WORD_COUNT) {
+                    return NOT_FOUND;
+                }
+
+                remaining = m_words[i];
+            }
+
+            return (i * 32) + countTrailingZeros(remaining);
+        }
+
+        constexpr Iterator begin() const
+        {
+            return Iterator(*this, findFirst());
+        }
+
+        constexpr Iterator end() const
+        {
+            return Iterator(*this, NOT_FOUND);
+        }
+
+        constexpr BitSet& operator|=(const BitSet& other)
+        {
+            for (uint32_t i = 0; i < WORD_COUNT; ++i) {
+                m_words[i] |= other.m_words[i];
+            }
+
+            return *this;
+        }
+
+        constexpr BitSet& operator&=(const BitSet& other)
+        {
+            for (uint32_t i = 0; i < WORD_COUNT; ++i) {
+                m_words[i] &= other.m_words[i];
+            }
+
+            return *this;
+        }
+
+        constexpr bool operator==(const BitSet& other) const = default;
+
+    private:
+        static constexpr uint32_t LAST_WORD_MASK = (N % 32 == 0) ? 0xFFFFFFFFu : ((uint32_t{1} << (N % 32)) - 1u);
+
+        uint32_t m_words[WORD_COUNT] = {};
+    };
+}
@@ -0,0 +1,103 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace ArmCortex {
+    //! Shareability domain and access type of a DMB or DSB barrier.
+    //! \note ARMv6-M and ARMv7-M architecturally define only SY, the other options are
+    //!       executed as SY there. They become meaningful on multi-core and ARMv8-M systems.
+    enum class BarrierOption : uint8_t {
+        OSHST = 0b0010, //!< Outer shareable, stores only.
+        OSH = 0b0011, //!< Outer shareable, loads and stores.
+        NSHST = 0b0110, //!< Non-shareable, stores only.
+        NSH = 0b0111, //!< Non-shareable, loads and stores.
+        ISHST = 0b1010, //!< Inner shareable, stores only.
+        ISH = 0b1011, //!< Inner shareable, loads and stores.
+        ST = 0b1110, //!< Full system, stores only.
+        SY = 0b1111 //!< Full system, loads and stores.
+    };
+
+    //! Data Synchronization Barrier.
+    //! Completes when all explicit memory accesses before it have completed.
+    //! \tparam option Shareability domain and access type.
+    template<BarrierOption option = BarrierOption::SY>
+    [[gnu::always_inline]] static inline void asmDsb()
+    {
+        if constexpr (option == BarrierOption::OSHST) {
+            asm volatile("dsb oshst" ::: "memory");
+        } else if constexpr (option == BarrierOption::OSH) {
+            asm volatile("dsb osh" ::: "memory");
+        } else if constexpr (option == BarrierOption::NSHST) {
+            asm volatile("dsb nshst" ::: "memory");
+        } else if constexpr (option == BarrierOption::NSH) {
+            asm volatile("dsb nsh" ::: "memory");
+        } else if constexpr (option == BarrierOption::ISHST) {
+            asm volatile("dsb ishst" ::: "memory");
+        } else if constexpr (option == BarrierOption::ISH) {
+            asm volatile("dsb ish" ::: "memory");
+        } else if constexpr (option == BarrierOption::ST) {
+            asm volatile("dsb st" ::: "memory");
+        } else {
+            asm volatile("dsb sy" ::: "memory");
+        }
+    }
+
+    //! Data Memory Barrier.
+    //! Orders explicit memory accesses before it against those after it, without waiting
+    //! for completion. Cheaper than DSB, e.g. DMB ISHST between filling a queue slot and
+    //! publishing its index.
+    //! \tparam option Shareability domain and access type.
+    template<BarrierOption option = BarrierOption::SY>
+    [[gnu::always_inline]] static inline void asmDmb()
+    {
+        if constexpr (option == BarrierOption::OSHST) {
+            asm volatile("dmb oshst" ::: "memory");
+        } else if constexpr (option == BarrierOption::OSH) {
+            asm volatile("dmb osh" ::: "memory");
+        } else if constexpr (option == BarrierOption::NSHST) {
+            asm volatile("dmb nshst" ::: "memory");
+        } else if constexpr (option == BarrierOption::NSH) {
+            asm volatile("dmb nsh" ::: "memory");
+        } else if constexpr (option == BarrierOption::ISHST) {
+            asm volatile("dmb ishst" ::: "memory");
+        } else if constexpr (option == BarrierOption::ISH) {
+            asm volatile("dmb ish" ::: "memory");
+        } else if constexpr (option == BarrierOption::ST) {
+            asm volatile("dmb st" ::: "memory");
+        } else {
+            asm volatile("dmb sy" ::: "memory");
+        }
+    }
+
+    //! Instruction Synchronization Barrier.
+    //! Flushes the pipeline so following instructions are fetched after the barrier completes,
+    //! e.g. after writing CONTROL, CPACR or MPU registers.
+    [[gnu::always_inline]] static inline void asmIsb()
+    {
+        asm volatile("isb sy" ::: "memory");
+    }
+
+    //! Compiler-only memory barrier.
+    //! Prevents the compiler from reordering or caching memory accesses across it, emits no instruction.
+    //! Sufficient between code running on the same core (e.g. thread code and an ISR).
+    [[gnu::always_inline]] static inline void compilerBarrier()
+    {
+        asm volatile("" ::: "memory");
+    }
+}
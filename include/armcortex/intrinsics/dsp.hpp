@@ -0,0 +1,483 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ArmCortex::Dsp {
+    using Int16x2 = int32_t; //!< Two packed signed halfwords, bits [15:0] hold the bottom and bits [31:16] the top halfword.
+    using Uint8x4 = uint32_t; //!< Four packed unsigned bytes, bits [7:0] hold byte 0.
+
+    //! Pack two signed halfwords into an Int16x2 value.
+    [[gnu::always_inline]] constexpr Int16x2 pack16(int16_t top, int16_t bottom)
+    {
+        return static_cast<Int16x2>((static_cast<uint32_t>(static_cast<uint16_t>(top)) << 16) | static_cast<uint16_t>(bottom));
+    }
+
+    //! Bottom signed halfword of an Int16x2 value.
+    [[gnu::always_inline]] constexpr int16_t bottom16(Int16x2 value)
+    {
+        return static_cast<int16_t>(static_cast<uint32_t>(value) & 0xFFFFu);
+    }
+
+    //! Top signed halfword of an Int16x2 value.
+    [[gnu::always_inline]] constexpr int16_t top16(Int16x2 value)
+    {
+        return static_cast<int16_t>(static_cast<uint32_t>(value) >> 16);
+    }
+
+    //! n-th unsigned byte of an Uint8x4 value.
+    [[gnu::always_inline]] constexpr uint8_t byte8(Uint8x4 value, uint8_t n)
+    {
+        return static_cast<uint8_t>(value >> (8 * n));
+    }
+}
+
+//! Portable implementations with the exact results of the ARMv7E-M instructions.
+//! Used in constant evaluation and on cores without the DSP extension.
+namespace ArmCortex::Dsp::Portable {
+    [[gnu::always_inline]] constexpr int32_t saturate(int64_t value, int64_t min, int64_t max)
+    {
+        return static_cast<int32_t>((value > max) ? max : ((value < min) ? min : value));
+    }
+
+    template<uint8_t bits>
+    [[gnu::always_inline]] constexpr int32_t ssat(int32_t value)
+    {
+        return saturate(value, -(int64_t{1} << (bits - 1)), (int64_t{1} << (bits - 1)) - 1);
+    }
+
+    template<uint8_t bits>
+    [[gnu::always_inline]] constexpr uint32_t usat(int32_t value)
+    {
+        return static_cast<uint32_t>(saturate(value, 0, (int64_t{1} << bits) - 1));
+    }
+
+    [[gnu::always_inline]] constexpr int32_t qadd(int32_t a, int32_t b)
+    {
+        return saturate(int64_t{a} + b, INT32_MIN, INT32_MAX);
+    }
+
+    [[gnu::always_inline]] constexpr int32_t qsub(int32_t a, int32_t b)
+    {
+        return saturate(int64_t{a} - b, INT32_MIN, INT32_MAX);
+    }
+
+    [[gnu::always_inline]] constexpr Int16x2 sadd16(Int16x2 a, Int16x2 b)
+    {
+        return pack16(static_cast<int16_t>(top16(a) + top16(b)), static_cast<int16_t>(bottom16(a) + bottom16(b)));
+    }
+
+    [[gnu::always_inline]] constexpr Int16x2 ssub16(Int16x2 a, Int16x2 b)
+    {
+        return pack16(static_cast<int16_t>(top16(a) - top16(b)), static_cast<int16_t>(bottom16(a) - bottom16(b)));
+    }
+
+    [[gnu::always_inline]] constexpr Int16x2 qadd16(Int16x2 a, Int16x2 b)
+    {
+        return pack16(static_cast<int16_t>(saturate(top16(a) + top16(b), INT16_MIN, INT16_MAX)),
+            static_cast<int16_t>(saturate(bottom16(a) + bottom16(b), INT16_MIN, INT16_MAX)));
+    }
+
+    [[gnu::always_inline]] constexpr Int16x2 qsub16(Int16x2 a, Int16x2 b)
+    {
+        return pack16(static_cast<int16_t>(saturate(top16(a) - top16(b), INT16_MIN, INT16_MAX)),
+            static_cast<int16_t>(saturate(bottom16(a) - bottom16(b), INT16_MIN, INT16_MAX)));
+    }
+
+    [[gnu::always_inline]] constexpr Uint8x4 uadd8(Uint8x4 a, Uint8x4 b)
+    {
+        Uint8x4 result = 0;
+
+        for (uint8_t n = 0; n < 4; n++) {
+            result |= static_cast<Uint8x4>(static_cast<uint8_t>(byte8(a, n) + byte8(b, n))) << (8 * n);
+        }
+
+        return result;
+    }
+
+    [[gnu::always_inline]] constexpr Uint8x4 usub8(Uint8x4 a, Uint8x4 b)
+    {
+        Uint8x4 result = 0;
+
+        for (uint8_t n = 0; n < 4; n++) {
+            result |= static_cast<Uint8x4>(static_cast<uint8_t>(byte8(a, n) - byte8(b, n))) << (8 * n);
+        }
+
+        return result;
+    }
+
+    [[gnu::always_inline]] constexpr int32_t smuad(Int16x2 a, Int16x2 b)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(bottom16(a) * bottom16(b)) + static_cast<uint32_t>(top16(a) * top16(b)));
+    }
+
+    [[gnu::always_inline]] constexpr int32_t smusd(Int16x2 a, Int16x2 b)
+    {
+        return bottom16(a) * bottom16(b) - top16(a) * top16(b);
+    }
+
+    [[gnu::always_inline]] constexpr int32_t smlad(Int16x2 a, Int16x2 b, int32_t accumulator)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(accumulator) + static_cast<uint32_t>(smuad(a, b)));
+    }
+
+    [[gnu::always_inline]] constexpr int32_t smlsd(Int16x2 a, Int16x2 b, int32_t accumulator)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(accumulator) + static_cast<uint32_t>(smusd(a, b)));
+    }
+
+    //! APSR.GE flags sadd16() sets: GE[1:0] when the bottom sum is >= 0, GE[3:2] when the top sum is.
+    [[gnu::always_inline]] constexpr uint8_t geSadd16(Int16x2 a, Int16x2 b)
+    {
+        return static_cast<uint8_t>(((bottom16(a) + bottom16(b) >= 0) ? 0b0011u : 0u) | ((top16(a) + top16(b) >= 0) ? 0b1100u : 0u));
+    }
+
+    //! APSR.GE flags ssub16() sets: GE[1:0] when the bottom difference is >= 0, GE[3:2] when the top difference is.
+    [[gnu::always_inline]] constexpr uint8_t geSsub16(Int16x2 a, Int16x2 b)
+    {
+        return static_cast<uint8_t>(((bottom16(a) - bottom16(b) >= 0) ? 0b0011u : 0u) | ((top16(a) - top16(b) >= 0) ? 0b1100u : 0u));
+    }
+
+    //! APSR.GE flags uadd8() sets: GE[n] when byte n of the sum carries out.
+    [[gnu::always_inline]] constexpr uint8_t geUadd8(Uint8x4 a, Uint8x4 b)
+    {
+        uint8_t ge = 0;
+
+        for (uint8_t n = 0; n < 4; n++) {
+            if (byte8(a, n) + byte8(b, n) > 0xFF) {
+                ge |= static_cast<uint8_t>(1u << n);
+            }
+        }
+
+        return ge;
+    }
+
+    //! APSR.GE flags usub8() sets: GE[n] when byte n of a is >= byte n of b.
+    [[gnu::always_inline]] constexpr uint8_t geUsub8(Uint8x4 a, Uint8x4 b)
+    {
+        uint8_t ge = 0;
+
+        for (uint8_t n = 0; n < 4; n++) {
+            if (byte8(a, n) >= byte8(b, n)) {
+                ge |= static_cast<uint8_t>(1u << n);
+            }
+        }
+
+        return ge;
+    }
+
+    //! SEL with explicit GE flags: byte n comes from a when bit n of ge is set, otherwise from b.
+    //! E.g. sel(a, b, geUsub8(a, b)) is the bytewise unsigned maximum.
+    [[gnu::always_inline]] constexpr uint32_t sel(uint32_t a, uint32_t b, uint8_t ge)
+    {
+        uint32_t result = 0;
+
+        for (uint8_t n = 0; n < 4; n++) {
+            result |= static_cast<uint32_t>(byte8(((ge >> n) & 1u) ? a : b, n)) << (8 * n);
+        }
+
+        return result;
+    }
+
+    template<uint8_t shift>
+    [[gnu::always_inline]] constexpr Int16x2 pkhbt(Int16x2 a, Int16x2 b)
+    {
+        return static_cast<Int16x2>((static_cast<uint32_t>(a) & 0x0000FFFFu) | ((static_cast<uint32_t>(b) << shift) & 0xFFFF0000u));
+    }
+
+    template<uint8_t shift>
+    [[gnu::always_inline]] constexpr Int16x2 pkhtb(Int16x2 a, Int16x2 b)
+    {
+        return static_cast<Int16x2>((static_cast<uint32_t>(a) & 0xFFFF0000u) | (static_cast<uint32_t>(b >> shift) & 0x0000FFFFu));
+    }
+}
+
+//! ARMv7E-M SIMD and saturating arithmetic.
+//! On cores with the DSP extension (Cortex-M4, M7) each function lowers to a single instruction.
+//! SSAT and USAT are also native on Cortex-M3. Everywhere else, and in constant evaluation,
+//! the Portable implementations are used.
+//! \note SADD16, SSUB16, UADD8 and USUB8 set the APSR.GE flags consumed by sel(), so they are
+//!       emitted as volatile asm and are never reordered or removed relative to sel().
+namespace ArmCortex::Dsp {
+    //! Saturate a signed value to a signed range of the given bit width (SSAT).
+    //! \tparam bits Saturation width (1-32).
+    template<uint8_t bits>
+    [[gnu::always_inline]] constexpr int32_t ssat(int32_t value)
+    {
+        static_assert((bits >= 1) && (bits <= 32), "SSAT saturation width must be 1-32 bits");
+
+#if defined(__ARM_FEATURE_SAT)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("ssat %0, %1, %2" : "=r" (result) : "I" (bits), "r" (value));
+            return result;
+        }
+#endif
+
+        return Portable::ssat<bits>(value);
+    }
+
+    //! Saturate a signed value to an unsigned range of the given bit width (USAT).
+    //! \tparam bits Saturation width (0-31).
+    template<uint8_t bits>
+    [[gnu::always_inline]] constexpr uint32_t usat(int32_t value)
+    {
+        static_assert(bits <= 31, "USAT saturation width must be 0-31 bits");
+
+#if defined(__ARM_FEATURE_SAT)
+        if (!std::is_constant_evaluated()) {
+            uint32_t result;
+            asm("usat %0, %1, %2" : "=r" (result) : "I" (bits), "r" (value));
+            return result;
+        }
+#endif
+
+        return Portable::usat<bits>(value);
+    }
+
+    //! Saturating signed 32-bit addition (QADD).
+    [[gnu::always_inline]] constexpr int32_t qadd(int32_t a, int32_t b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("qadd %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+            return result;
+        }
+#endif
+
+        return Portable::qadd(a, b);
+    }
+
+    //! Saturating signed 32-bit subtraction (QSUB).
+    [[gnu::always_inline]] constexpr int32_t qsub(int32_t a, int32_t b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("qsub %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+            return result;
+        }
+#endif
+
+        return Portable::qsub(a, b);
+    }
+
+    //! Dual 16-bit signed addition, sets APSR.GE (SADD16).
+    [[gnu::always_inline]] constexpr Int16x2 sadd16(Int16x2 a, Int16x2 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Int16x2 result;
+            asm volatile("sadd16 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b) : "cc");
+            return result;
+        }
+#endif
+
+        return Portable::sadd16(a, b);
+    }
+
+    //! Dual 16-bit signed subtraction, sets APSR.GE (SSUB16).
+    [[gnu::always_inline]] constexpr Int16x2 ssub16(Int16x2 a, Int16x2 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Int16x2 result;
+            asm volatile("ssub16 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b) : "cc");
+            return result;
+        }
+#endif
+
+        return Portable::ssub16(a, b);
+    }
+
+    //! Dual 16-bit saturating signed addition (QADD16).
+    [[gnu::always_inline]] constexpr Int16x2 qadd16(Int16x2 a, Int16x2 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Int16x2 result;
+            asm("qadd16 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+            return result;
+        }
+#endif
+
+        return Portable::qadd16(a, b);
+    }
+
+    //! Dual 16-bit saturating signed subtraction (QSUB16).
+    [[gnu::always_inline]] constexpr Int16x2 qsub16(Int16x2 a, Int16x2 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Int16x2 result;
+            asm("qsub16 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+            return result;
+        }
+#endif
+
+        return Portable::qsub16(a, b);
+    }
+
+    //! Quad 8-bit unsigned addition, sets APSR.GE on carry out of each byte (UADD8).
+    [[gnu::always_inline]] constexpr Uint8x4 uadd8(Uint8x4 a, Uint8x4 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Uint8x4 result;
+            asm volatile("uadd8 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b) : "cc");
+            return result;
+        }
+#endif
+
+        return Portable::uadd8(a, b);
+    }
+
+    //! Quad 8-bit unsigned subtraction, sets APSR.GE for each byte where a >= b (USUB8).
+    [[gnu::always_inline]] constexpr Uint8x4 usub8(Uint8x4 a, Uint8x4 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Uint8x4 result;
+            asm volatile("usub8 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b) : "cc");
+            return result;
+        }
+#endif
+
+        return Portable::usub8(a, b);
+    }
+
+    //! Dual 16-bit signed multiply with addition of products (SMUAD).
+    [[gnu::always_inline]] constexpr int32_t smuad(Int16x2 a, Int16x2 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("smuad %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+            return result;
+        }
+#endif
+
+        return Portable::smuad(a, b);
+    }
+
+    //! Dual 16-bit signed multiply with subtraction of products (SMUSD).
+    [[gnu::always_inline]] constexpr int32_t smusd(Int16x2 a, Int16x2 b)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("smusd %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+            return result;
+        }
+#endif
+
+        return Portable::smusd(a, b);
+    }
+
+    //! Dual 16-bit signed multiply-accumulate (SMLAD): accumulator + a.bottom * b.bottom + a.top * b.top.
+    [[gnu::always_inline]] constexpr int32_t smlad(Int16x2 a, Int16x2 b, int32_t accumulator)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("smlad %0, %1, %2, %3" : "=r" (result) : "r" (a), "r" (b), "r" (accumulator));
+            return result;
+        }
+#endif
+
+        return Portable::smlad(a, b, accumulator);
+    }
+
+    //! Dual 16-bit signed multiply-subtract-accumulate (SMLSD): accumulator + a.bottom * b.bottom - a.top * b.top.
+    [[gnu::always_inline]] constexpr int32_t smlsd(Int16x2 a, Int16x2 b, int32_t accumulator)
+    {
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            int32_t result;
+            asm("smlsd %0, %1, %2, %3" : "=r" (result) : "r" (a), "r" (b), "r" (accumulator));
+            return result;
+        }
+#endif
+
+        return Portable::smlsd(a, b, accumulator);
+    }
+
+    //! Pack the bottom halfword of a with the top halfword of b shifted left (PKHBT).
+    //! \tparam shift Left shift applied to b (0-31).
+    template<uint8_t shift = 0>
+    [[gnu::always_inline]] constexpr Int16x2 pkhbt(Int16x2 a, Int16x2 b)
+    {
+        static_assert(shift <= 31, "PKHBT shift must be 0-31");
+
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Int16x2 result;
+
+            if constexpr (shift == 0) {
+                asm("pkhbt %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+            } else {
+                asm("pkhbt %0, %1, %2, lsl %3" : "=r" (result) : "r" (a), "r" (b), "I" (shift));
+            }
+
+            return result;
+        }
+#endif
+
+        return Portable::pkhbt<shift>(a, b);
+    }
+
+    //! Pack the top halfword of a with the bottom halfword of b arithmetically shifted right (PKHTB).
+    //! \tparam shift Arithmetic right shift applied to b (0-31).
+    template<uint8_t shift = 0>
+    [[gnu::always_inline]] constexpr Int16x2 pkhtb(Int16x2 a, Int16x2 b)
+    {
+        static_assert(shift <= 31, "PKHTB shift must be 0-31");
+
+#if defined(__ARM_FEATURE_DSP)
+        if (!std::is_constant_evaluated()) {
+            Int16x2 result;
+
+            if constexpr (shift == 0) {
+                // PKHTB cannot encode a zero shift, the operands swapped PKHBT is equivalent.
+                asm("pkhbt %0, %2, %1" : "=r" (result) : "r" (a), "r" (b));
+            } else {
+                asm("pkhtb %0, %1, %2, asr %3" : "=r" (result) : "r" (a), "r" (b), "I" (shift));
+            }
+
+            return result;
+        }
+#endif
+
+        return Portable::pkhtb<shift>(a, b);
+    }
+
+#if defined(__ARM_FEATURE_DSP)
+    //! Select each byte from a where the corresponding APSR.GE flag is set, otherwise from b (SEL).
+    //! GE flags are set by a preceding sadd16(), ssub16(), uadd8() or usub8().
+    //! \note Available on ARMv7E-M (Cortex-M4, M7, M33) only. Other cores have no GE flags, use
+    //!       Portable::sel() with the flags from Portable::geSadd16(), geSsub16(), geUadd8() or geUsub8().
+    [[gnu::always_inline]] static inline uint32_t sel(uint32_t a, uint32_t b)
+    {
+        uint32_t result;
+        asm volatile("sel %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+        return result;
+    }
+#endif
+}
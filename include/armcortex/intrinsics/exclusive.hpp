@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace ArmCortex {
+#if defined(__ARM_FEATURE_LDREX)
+    //! Load Register Exclusive (word).
+    //! Loads a word and marks the address for exclusive access by the local monitor.
+    //! \note Available on ARMv7-M (Cortex-M3, M4, M7) only.
+    [[gnu::always_inline]] static inline uint32_t asmLdrex(volatile uint32_t* addr)
+    {
+        uint32_t result;
+        asm volatile("ldrex %0, %1" : "=r" (result) : "Q" (*addr) : "memory");
+        return result;
+    }
+
+    //! Load Register Exclusive (halfword).
+    //! \note Available on ARMv7-M (Cortex-M3, M4, M7) only.
+    [[gnu::always_inline]] static inline uint16_t asmLdrexh(volatile uint16_t* addr)
+    {
+        uint32_t result;
+        asm volatile("ldrexh %0, %1" : "=r" (result) : "Q" (*addr) : "memory");
+        return static_cast<uint16_t>(result);
+    }
+
+    //! Load Register Exclusive (byte).
+    //! \note Available on ARMv7-M (Cortex-M3, M4, M7) only.
+    [[gnu::always_inline]] static inline uint8_t asmLdrexb(volatile uint8_t* addr)
+    {
+        uint32_t result;
+        asm volatile("ldrexb %0, %1" : "=r" (result) : "Q" (*addr) : "memory");
+        return static_cast<uint8_t>(result);
+    }
+
+    //! Store Register Exclusive (word).
+    //! Stores a word only if the local monitor still holds exclusive access to the address.
+    //! \return 0 if the store was performed, 1 if it failed and the sequence must be retried.
+    //! \note Available on ARMv7-M (Cortex-M3, M4, M7) only.
+    [[gnu::always_inline]] static inline uint32_t asmStrex(uint32_t value, volatile uint32_t* addr)
+    {
+        uint32_t status;
+        asm volatile("strex %0, %2, %1" : "=&r" (status), "=Q" (*addr) : "r" (value) : "memory");
+        return status;
+    }
+
+    //! Store Register Exclusive (halfword).
+    //! \return 0 if the store was performed, 1 if it failed and the sequence must be retried.
+    //! \note Available on ARMv7-M (Cortex-M3, M4, M7) only.
+    [[gnu::always_inline]] static inline uint32_t asmStrexh(uint16_t value, volatile uint16_t* addr)
+    {
+        uint32_t status;
+        asm volatile("strexh %0, %2, %1" : "=&r" (status), "=Q" (*addr) : "r" (static_cast<uint32_t>(value)) : "memory");
+        return status;
+    }
+
+    //! Store Register Exclusive (byte).
+    //! \return 0 if the store was performed, 1 if it failed and the sequence must be retried.
+    //! \note Available on ARMv7-M (Cortex-M3, M4, M7) only.
+    [[gnu::always_inline]] static inline uint32_t asmStrexb(uint8_t value, volatile uint8_t* addr)
+    {
+        uint32_t status;
+        asm volatile("strexb %0, %2, %1" : "=&r" (status), "=Q" (*addr) : "r" (static_cast<uint32_t>(value)) : "memory");
+        return status;
+    }
+
+    //! Clear Exclusive.
+    //! Clears the local monitor so a pending STREX of the interrupted code fails.
+    //! \note Available on ARMv7-M (Cortex-M3, M4, M7) only.
+    [[gnu::always_inline]] static inline void asmClrex()
+    {
+        asm volatile("clrex" : : : "memory");
+    }
+#endif
+
+    //! Clear the local exclusive monitor on a context switch.
+    //! Call from the context switch handler (e.g. PendSV) before resuming another thread, so a
+    //! LDREX/STREX sequence interrupted in one thread cannot succeed in another.
+    //! Compiles to nothing on ARMv6-M, which has no exclusive monitor.
+    [[gnu::always_inline]] static inline void clearExclusiveMonitor()
+    {
+#if defined(__ARM_FEATURE_LDREX)
+        asmClrex();
+#endif
+    }
+}
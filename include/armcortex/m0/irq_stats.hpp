@@ -0,0 +1,118 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/m0/exceptions.hpp"
+#include "armcortex/m0/irq_trace.hpp"
+#include "armcortex/m0/special_regs.hpp"
+#include "armcortex/m0/systick.hpp"
+#include <cstdint>
+
+namespace ArmCortex::IrqStats {
+    inline constexpr uint16_t NUM_OF_EXCEPTIONS = static_cast<uint16_t>(ExceptionNumber::LAST_IRQ) + 1;
+
+    //! Statistics of one exception handler, times in IrqTrace::getTimestamp() ticks.
+    //! Times include handlers that preempted it.
+    struct Entry {
+        uint32_t count; //!< Number of completed runs.
+        uint32_t total; //!< Sum of run times, wraps around.
+        uint32_t max; //!< Longest run.
+        uint32_t min; //!< Shortest run, 0 before the first run.
+    };
+
+    //! Ticks from start to end of the down-counting SysTick, assuming less than one period in between.
+    [[gnu::always_inline]] static inline uint32_t elapsed(uint32_t start, uint32_t end)
+    {
+        return (start >= end) ? (start - end) : (start + SYS_TICK->LOAD + 1 - end);
+    }
+
+    //! Per-exception statistics table.
+    //! Each entry is only written by its own handler, which cannot preempt itself, so updates are plain
+    //! loads and stores without atomics or interrupt masking.
+    //! \tparam num_of_exceptions Number of entries, exception numbers from 0 to num_of_exceptions - 1.
+    template<uint16_t num_of_exceptions = NUM_OF_EXCEPTIONS>
+    class Table {
+    public:
+        //! Add a run of an exception handler.
+        //! Runs of exceptions numbered num_of_exceptions or higher are ignored, so a table smaller than
+        //! NUM_OF_EXCEPTIONS is safe to use with measured() in any handler.
+        [[gnu::always_inline]] inline void update(uint16_t exception, uint32_t ticks)
+        {
+            if (exception >= num_of_exceptions) {
+                return;
+            }
+
+            Entry& entry = m_entries[exception];
+            uint32_t count = entry.count + 1;
+            entry.count = count;
+            entry.total = entry.total + ticks;
+
+            if (ticks > entry.max) {
+                entry.max = ticks;
+            }
+
+            if ((ticks < entry.min) || (count == 1)) {
+                entry.min = ticks;
+            }
+        }
+
+        //! Copy the statistics, optionally clearing them to start a new measurement period.
+        //! Each entry is copied with interrupts disabled, so it is consistent with respect to its handler,
+        //! while interrupts are held off for one entry at a time only.
+        void snapshot(Entry (&copy)[num_of_exceptions], bool reset = false)
+        {
+            for (uint16_t exception = 0; exception < num_of_exceptions; exception++) {
+                PRIMASK primask = getPrimaskReg();
+                asmCpsid();
+
+                copy[exception] = m_entries[exception];
+
+                if (reset) {
+                    m_entries[exception] = Entry {};
+                }
+
+                setPrimaskReg(primask);
+            }
+        }
+
+        //! Statistics of one exception, may be inconsistent when read from a lower priority than its handler.
+        const Entry& operator[](uint16_t exception) const
+        {
+            return m_entries[exception];
+        }
+
+    private:
+        Entry m_entries[num_of_exceptions] = {};
+    };
+
+    //! Run an interrupt handler and add its run time to the table:
+    //! \code
+    //! ArmCortex::IrqStats::Table<> irq_stats;
+    //! extern "C" void TIM2_IRQHandler() { ArmCortex::IrqStats::measured<irq_stats, &handleTimer>(); }
+    //! \endcode
+    //! \tparam table Table instance.
+    //! \tparam handler Interrupt handler body.
+    template<auto& table, void (*handler)()>
+    [[gnu::always_inline]] static inline void measured()
+    {
+        uint32_t start = IrqTrace::getTimestamp();
+        handler();
+        uint32_t end = IrqTrace::getTimestamp();
+        table.update(static_cast<uint16_t>(getIpsrReg().bits.ISR), elapsed(start, end));
+    }
+}
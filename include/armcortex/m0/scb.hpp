@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/register_field.hpp"
 #include <cstdint>
 
 namespace ArmCortex::Scb {
@@ -45,6 +47,12 @@ namespace ArmCortex::Scb {
             uint32_t IMPLEMENTER: 8; //!< Implementer code (0x41: ARM).
         } bits;
 
+        static constexpr Field<CPUID, 0, 4, FieldAccess::RO> REVISION_FIELD {};
+        static constexpr Field<CPUID, 4, 12, FieldAccess::RO> PARTNO_FIELD {};
+        static constexpr Field<CPUID, 16, 4, FieldAccess::RO> ARCHITECTURE_FIELD {};
+        static constexpr Field<CPUID, 20, 4, FieldAccess::RO> VARIANT_FIELD {};
+        static constexpr Field<CPUID, 24, 8, FieldAccess::RO> IMPLEMENTER_FIELD {};
+
         uint32_t value = 0;
 
         CPUID() = default;
@@ -76,6 +84,18 @@ namespace ArmCortex::Scb {
             uint32_t NMIPENDSET: 1; //!< NMI pending (read), write 1 to set pending.
         } bits;
 
+        static constexpr uint32_t WRITE_ONE_MASK = 0x9E000000u; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<ICSR, 0, 9, FieldAccess::RO> VECTACTIVE_FIELD {};
+        static constexpr Field<ICSR, 12, 9, FieldAccess::RO> VECTPENDING_FIELD {};
+        static constexpr Field<ICSR, 22, 1, FieldAccess::RO> ISRPENDING_FIELD {};
+        static constexpr Field<ICSR, 23, 1, FieldAccess::RO> ISRPREEMPT_FIELD {};
+        static constexpr Field<ICSR, 25, 1, FieldAccess::W1C> PENDSTCLR_FIELD {};
+        static constexpr Field<ICSR, 26, 1, FieldAccess::W1S> PENDSTSET_FIELD {};
+        static constexpr Field<ICSR, 27, 1, FieldAccess::W1C> PENDSVCLR_FIELD {};
+        static constexpr Field<ICSR, 28, 1, FieldAccess::W1S> PENDSVSET_FIELD {};
+        static constexpr Field<ICSR, 31, 1, FieldAccess::W1S> NMIPENDSET_FIELD {};
+
         uint32_t value = 0;
 
         ICSR() = default;
@@ -99,6 +119,13 @@ namespace ArmCortex::Scb {
             uint32_t VECTKEY: 16; //!< Write VECTKEY_VALUE to enable writes, otherwise ignored.
         } bits;
 
+        static constexpr uint32_t WRITE_KEY = uint32_t{VECTKEY_VALUE} << 16; //!< Inserted by modify() and write().
+        static constexpr uint32_t WRITE_KEY_MASK = 0xFFFF0000u;
+
+        static constexpr Field<AIRCR, 1, 1> VECTCLRACTIVE_FIELD {};
+        static constexpr Field<AIRCR, 2, 1> SYSRESETREQ_FIELD {};
+        static constexpr Field<AIRCR, 15, 1, FieldAccess::RO> ENDIANNESS_FIELD {};
+
         uint32_t value = 0;
 
         AIRCR() = default;
@@ -120,6 +147,10 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED2: 27;
         } bits;
 
+        static constexpr Field<SCR, 1, 1> SLEEPONEXIT_FIELD {};
+        static constexpr Field<SCR, 2, 1> SLEEPDEEP_FIELD {};
+        static constexpr Field<SCR, 4, 1> SEVONPEND_FIELD {};
+
         uint32_t value = 0;
 
         SCR() = default;
@@ -140,6 +171,9 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED2: 22;
         } bits;
 
+        static constexpr Field<CCR, 3, 1> UNALIGN_TRP_FIELD {};
+        static constexpr Field<CCR, 9, 1> STKALIGN_FIELD {};
+
         uint32_t value = 0;
 
         CCR() = default;
@@ -157,6 +191,8 @@ namespace ArmCortex::Scb {
             uint32_t PRI_11: 8; //!< SVCall priority (exception 11).
         } bits;
 
+        static constexpr Field<SHPR2, 24, 8> PRI_11_FIELD {};
+
         uint32_t value = 0;
 
         SHPR2() = default;
@@ -175,6 +211,9 @@ namespace ArmCortex::Scb {
             uint32_t PRI_15: 8; //!< SysTick priority (exception 15).
         } bits;
 
+        static constexpr Field<SHPR3, 16, 8> PRI_14_FIELD {};
+        static constexpr Field<SHPR3, 24, 8> PRI_15_FIELD {};
+
         uint32_t value = 0;
 
         SHPR3() = default;
@@ -193,6 +232,8 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED1: 16;
         } bits;
 
+        static constexpr Field<SHCSR, 15, 1> SVCALLPENDED_FIELD {};
+
         uint32_t value = 0;
 
         SHCSR() = default;
@@ -211,7 +252,7 @@ namespace ArmCortex {
 namespace ArmCortex::Scb {
     [[gnu::noreturn, gnu::always_inline]] static inline void systemReset()
     {
-        asm volatile("dsb sy" ::: "memory");
+        asmDsb();
 
         AIRCR aircr { SCB->AIRCR };
 
@@ -221,8 +262,8 @@ namespace ArmCortex::Scb {
 
         SCB->AIRCR = aircr.value;
 
-        asm volatile("dsb sy" ::: "memory");
-        asm volatile("isb sy" ::: "memory");
+        asmDsb();
+        asmIsb();
 
         while(true);
     }
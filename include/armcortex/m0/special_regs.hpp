@@ -190,4 +190,29 @@ namespace ArmCortex {
     {
         asm volatile("MSR CONTROL, %0" : : "r" (control.value) : "cc", "memory");
     }
+
+    //! Switch thread mode from MSP to PSP, keeping the current stack contents, and give exceptions a stack of their own.
+    //! Copies MSP into PSP, sets CONTROL.SPSEL, executes an ISB and then moves MSP to main_stack_top, as a
+    //! single sequence the compiler cannot reorder or split. Thread code keeps growing its stack down from
+    //! the current address, exceptions are stacked from main_stack_top.
+    //! \param main_stack_top Initial main stack pointer for handlers (8-byte aligned end of a stack area that
+    //!        does not overlap the current stack, which belongs to thread mode from now on).
+    //! \note Call from privileged thread mode only, handler mode always uses MSP.
+    [[gnu::always_inline]] static inline void switchToPsp(uint32_t main_stack_top)
+    {
+        uint32_t stack_pointer;
+        uint32_t spsel_bit;
+
+        asm volatile(
+            "MRS %0, MSP\n\t"
+            "MSR PSP, %0\n\t"
+            "MRS %0, CONTROL\n\t"
+            "MOVS %1, #2\n\t"
+            "ORRS %0, %1\n\t"
+            "MSR CONTROL, %0\n\t"
+            "ISB\n\t"
+            "MSR MSP, %2"
+            : "=&l" (stack_pointer), "=&l" (spsel_bit) : "l" (main_stack_top) : "cc", "memory"
+        );
+    }
 }
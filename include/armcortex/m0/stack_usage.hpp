@@ -0,0 +1,161 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/m0/special_regs.hpp"
+#include <cstdint>
+
+namespace ArmCortex::StackUsage {
+    inline constexpr uint32_t PAINT_PATTERN = 0xA5A5A5A5u; //!< Fill value of unused stack words.
+
+    //! Stack memory area, growing down from top towards limit.
+    struct Region {
+        uint32_t* limit; //!< Lowest word of the stack area.
+        uint32_t* top; //!< One past the highest word, i.e. the initial stack pointer.
+
+        //! Size of the stack area in bytes.
+        constexpr uint32_t size() const
+        {
+            return static_cast<uint32_t>(top - limit) * sizeof(uint32_t);
+        }
+    };
+
+    //! Fill the part of the region below current_sp with PAINT_PATTERN.
+    //! Words at and above current_sp are in use and are left untouched. Nothing is painted when
+    //! current_sp is not above limit and at most top (full or overflowed stack, or another stack's pointer).
+    //! \note Volatile stores keep the compiler from turning the loop into a memset call, which would
+    //!       itself use the stack being painted. Always inlined, so the loop never runs in a frame of its
+    //!       own below the stack pointer the caller captured.
+    [[gnu::always_inline]] static inline void paint(Region region, uintptr_t current_sp)
+    {
+        if ((current_sp <= reinterpret_cast<uintptr_t>(region.limit)) || (current_sp > reinterpret_cast<uintptr_t>(region.top))) {
+            return;
+        }
+
+        volatile uint32_t* word = region.limit;
+        volatile uint32_t* end = reinterpret_cast<volatile uint32_t*>(current_sp & ~uintptr_t{3u});
+
+        while (word < end) {
+            *word = PAINT_PATTERN;
+            word++;
+        }
+    }
+
+    //! Maximum number of bytes of the region ever used, measured from its top.
+    //! Scans up from limit to the first overwritten word, stopping at current_sp, since everything
+    //! above it is live anyway. The cost is proportional to the remaining headroom, not the stack size.
+    //! A current_sp at or below limit reports the whole region as used, one above top scans the whole region.
+    //! \note Only meaningful for a region painted with paint().
+    [[gnu::always_inline]] static inline uint32_t highWaterMark(Region region, uintptr_t current_sp)
+    {
+        if (current_sp <= reinterpret_cast<uintptr_t>(region.limit)) {
+            return region.size();
+        }
+
+        const volatile uint32_t* word = region.limit;
+        const volatile uint32_t* end = region.top;
+
+        if (current_sp < reinterpret_cast<uintptr_t>(region.top)) {
+            end = reinterpret_cast<const volatile uint32_t*>(current_sp & ~uintptr_t{3u});
+        }
+
+        while ((word < end) && (*word == PAINT_PATTERN)) {
+            word++;
+        }
+
+        return static_cast<uint32_t>(region.top - const_cast<const uint32_t*>(word)) * sizeof(uint32_t);
+    }
+
+    //! Number of bytes of the region never used so far.
+    [[gnu::always_inline]] static inline uint32_t headroom(Region region, uintptr_t current_sp)
+    {
+        return region.size() - highWaterMark(region, current_sp);
+    }
+
+    //! Paint the unused part of the main stack, call early at startup.
+    [[gnu::always_inline]] static inline void paintMainStack(Region region)
+    {
+        paint(region, getMspReg());
+    }
+
+    //! Paint the unused part of the process stack.
+    //! \note Before the process stack is first used, paint it whole with paint(region, top) instead.
+    [[gnu::always_inline]] static inline void paintProcessStack(Region region)
+    {
+        paint(region, getPspReg());
+    }
+
+    //! High-water mark of the main stack in bytes.
+    [[gnu::always_inline]] static inline uint32_t mainStackHighWaterMark(Region region)
+    {
+        return highWaterMark(region, getMspReg());
+    }
+
+    //! High-water mark of the process stack in bytes.
+    [[gnu::always_inline]] static inline uint32_t processStackHighWaterMark(Region region)
+    {
+        return highWaterMark(region, getPspReg());
+    }
+
+    //! Periodic high-water mark sampler.
+    //! Call sample() from a low-priority periodic context (e.g. a lowest priority timer interrupt or
+    //! the idle loop) and read the peak usage in bytes with peak().
+    class Sampler {
+    public:
+        //! Stack pointer used by the sampled stack.
+        enum class Stack : uint8_t {
+            MAIN, //!< Main stack, MSP.
+            PROCESS //!< Process stack, PSP.
+        };
+
+        constexpr Sampler(Region region, Stack stack) :
+            m_region(region),
+            m_stack(stack)
+        {
+        }
+
+        //! Update and return the peak usage in bytes.
+        uint32_t sample()
+        {
+            uintptr_t current_sp = (m_stack == Stack::MAIN) ? getMspReg() : getPspReg();
+            uint32_t used = highWaterMark(m_region, current_sp);
+
+            if (used > m_peak) {
+                m_peak = used;
+            }
+
+            return m_peak;
+        }
+
+        //! Peak usage in bytes recorded by the last sample().
+        constexpr uint32_t peak() const
+        {
+            return m_peak;
+        }
+
+        //! Unused bytes of the stack according to the last sample().
+        constexpr uint32_t headroom() const
+        {
+            return m_region.size() - m_peak;
+        }
+
+    private:
+        Region m_region;
+        Stack m_stack;
+        uint32_t m_peak = 0;
+    };
+}
@@ -0,0 +1,128 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/atomic.hpp"
+#include "armcortex/m0plus/special_regs.hpp"
+#include "armcortex/m0plus/systick.hpp"
+#include <cstdint>
+
+namespace ArmCortex::IrqTrace {
+    inline constexpr uint32_t MAGIC = 0x54515249u; //!< "IRQT" in memory, lets the host tool find the buffer in a dump.
+    inline constexpr uint32_t UNKNOWN_TIMER_PERIOD = 0xFFFFFFFFu; //!< Stored until reset() records the SysTick period.
+
+    //! Kind of a trace event.
+    enum class EventKind : uint16_t {
+        ENTRY = 0, //!< Handler started.
+        EXIT = 1, //!< Handler finished.
+        TRIGGER = 2 //!< Interrupt source triggered, see trigger().
+    };
+
+    //! Trace event as stored in the buffer.
+    struct Event {
+        uint32_t timestamp; //!< SysTick VAL value.
+        uint16_t exception; //!< Exception number (IPSR).
+        EventKind kind;
+    };
+
+    //! Timestamp source, the 24-bit down-counting SysTick value (ARMv6-M has no cycle counter).
+    //! Intervals are only unambiguous when shorter than one SysTick period.
+    //! \note SysTick must be running.
+    [[gnu::always_inline]] static inline uint32_t getTimestamp()
+    {
+        return SYS_TICK->VAL;
+    }
+
+    //! Lock-free ring buffer of trace events, written from any priority level.
+    //! The header words let the host tool (tools/irq_trace.py) decode a raw memory dump of the object.
+    //! \tparam capacity Number of kept events, a power of two.
+    template<uint32_t capacity>
+    class Buffer {
+        static_assert((capacity != 0) && ((capacity & (capacity - 1)) == 0), "Capacity must be a power of two.");
+
+    public:
+        constexpr Buffer() = default;
+
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        //! Record an event.
+        //! The timestamp is taken inside the slot reservation retry loop, so a handler preempting
+        //! the recording forces a retry and events are stored in timestamp order.
+        [[gnu::always_inline]] inline void record(EventKind kind, uint16_t exception)
+        {
+            uint32_t index = m_head.load();
+            uint32_t timestamp;
+
+            do {
+                timestamp = getTimestamp();
+            } while (!m_head.compareExchange(index, index + 1));
+
+            Event& event = m_events[index & (capacity - 1)];
+            event.timestamp = timestamp;
+            event.exception = exception;
+            event.kind = kind;
+        }
+
+        //! Discard all events and store the SysTick period for the host tool.
+        //! \note Call once after SysTick is configured, and again whenever its reload value changes.
+        //!       The host tool refuses a buffer that was never reset, its intervals would be meaningless.
+        void reset()
+        {
+            m_timer_period = SYS_TICK->LOAD + 1;
+            m_head.store(0);
+        }
+
+        //! Number of events recorded since reset, including overwritten ones.
+        uint32_t total() const
+        {
+            return m_head.load();
+        }
+
+    private:
+        uint32_t m_magic = MAGIC;
+        uint32_t m_capacity = capacity;
+        uint32_t m_timer_period = UNKNOWN_TIMER_PERIOD; //!< Down-counting timestamps wrap at this period.
+        Atomic<uint32_t> m_head;
+        Event m_events[capacity] = {};
+    };
+
+    //! Run an interrupt handler with entry and exit events recorded:
+    //! \code
+    //! ArmCortex::IrqTrace::Buffer<256> irq_trace;
+    //! extern "C" void TIM2_IRQHandler() { ArmCortex::IrqTrace::traced<irq_trace, &handleTimer>(); }
+    //! \endcode
+    //! \tparam buffer Buffer instance.
+    //! \tparam handler Interrupt handler body.
+    template<auto& buffer, void (*handler)()>
+    [[gnu::always_inline]] static inline void traced()
+    {
+        uint16_t exception = static_cast<uint16_t>(getIpsrReg().bits.ISR);
+        buffer.record(EventKind::ENTRY, exception);
+        handler();
+        buffer.record(EventKind::EXIT, exception);
+    }
+
+    //! Record that an interrupt source was triggered, the host tool reports the time to its next ENTRY as latency.
+    //! E.g. call it right before pending an interrupt or starting a transfer that ends with one.
+    template<auto& buffer>
+    [[gnu::always_inline]] static inline void trigger(uint16_t exception)
+    {
+        buffer.record(EventKind::TRIGGER, exception);
+    }
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/register_field.hpp"
 #include <cstdint>
 
 namespace ArmCortex::Mpu {
@@ -39,6 +41,10 @@ namespace ArmCortex::Mpu {
             uint32_t RESERVED1: 8;
         } bits;
 
+        static constexpr Field<TYPE, 0, 1, FieldAccess::RO> SEPARATE_FIELD {};
+        static constexpr Field<TYPE, 8, 8, FieldAccess::RO> DREGION_FIELD {};
+        static constexpr Field<TYPE, 16, 8, FieldAccess::RO> IREGION_FIELD {};
+
         uint32_t value = 0;
 
         TYPE() = default;
@@ -58,6 +64,10 @@ namespace ArmCortex::Mpu {
             uint32_t RESERVED: 29;
         } bits;
 
+        static constexpr Field<CTRL, 0, 1> ENABLE_FIELD {};
+        static constexpr Field<CTRL, 1, 1> HFNMIENA_FIELD {};
+        static constexpr Field<CTRL, 2, 1> PRIVDEFENA_FIELD {};
+
         uint32_t value = 0;
 
         CTRL() = default;
@@ -76,6 +86,10 @@ namespace ArmCortex::Mpu {
             uint32_t ADDR: 27; //!< Region base address.
         } bits;
 
+        static constexpr Field<RBAR, 0, 4> REGION_FIELD {};
+        static constexpr Field<RBAR, 4, 1> VALID_FIELD {};
+        static constexpr Field<RBAR, 5, 27> ADDR_FIELD {};
+
         uint32_t value = 0;
 
         RBAR() = default;
@@ -123,6 +137,16 @@ namespace ArmCortex::Mpu {
             uint32_t RESERVED3: 3;
         } bits;
 
+        static constexpr Field<RASR, 0, 1> ENABLE_FIELD {};
+        static constexpr Field<RASR, 1, 5> SIZE_FIELD {};
+        static constexpr Field<RASR, 8, 8> SRD_FIELD {};
+        static constexpr Field<RASR, 16, 1> B_FIELD {};
+        static constexpr Field<RASR, 17, 1> C_FIELD {};
+        static constexpr Field<RASR, 18, 1> S_FIELD {};
+        static constexpr Field<RASR, 19, 3> TEX_FIELD {};
+        static constexpr Field<RASR, 24, 3> AP_FIELD {};
+        static constexpr Field<RASR, 28, 1> XN_FIELD {};
+
         uint32_t value = 0;
 
         RASR() = default;
@@ -156,7 +180,7 @@ namespace ArmCortex::Mpu {
 
         MPU->RASR = region_attributes.value;
 
-        asm volatile("dsb sy" ::: "memory");
-        asm volatile("isb sy" ::: "memory");
+        asmDsb();
+        asmIsb();
     }
 }
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "armcortex/register_field.hpp"
 #include <cstdint>
 
 namespace ArmCortex::SysTick {
@@ -45,6 +46,11 @@ namespace ArmCortex::SysTick {
             uint32_t RESERVED1: 15;
         } bits;
 
+        static constexpr Field<CTRL, 0, 1> ENABLE_FIELD {};
+        static constexpr Field<CTRL, 1, 1> TICKINT_FIELD {};
+        static constexpr Field<CTRL, 2, 1> CLKSOURCE_FIELD {};
+        static constexpr Field<CTRL, 16, 1, FieldAccess::RO> COUNTFLAG_FIELD {};
+
         uint32_t value = 0;
 
         CTRL() = default;
@@ -65,6 +71,10 @@ namespace ArmCortex::SysTick {
             uint32_t NOREF: 1; //!< Reads as 1: No separate reference clock provided.
         } bits;
 
+        static constexpr Field<CALIB, 0, 24, FieldAccess::RO> TENMS_FIELD {};
+        static constexpr Field<CALIB, 30, 1, FieldAccess::RO> SKEW_FIELD {};
+        static constexpr Field<CALIB, 31, 1, FieldAccess::RO> NOREF_FIELD {};
+
         uint32_t value = 0;
 
         CALIB() = default;
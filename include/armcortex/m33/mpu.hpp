@@ -0,0 +1,206 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::Mpu {
+    inline constexpr uintptr_t BASE_ADDRESS = 0xE000ED90u;
+
+    struct Registers {
+        volatile uint32_t TYPE; //!< Indicates whether the MPU is present, and if so, how many regions it supports.
+        volatile uint32_t CTRL; //!< MPU control register.
+        volatile uint32_t RNR; //!< Region number register (selects a region to edit its attributes).
+        volatile uint32_t RBAR; //!< Region base address register.
+        volatile uint32_t RLAR; //!< Region limit address register.
+        volatile uint32_t RBAR_A1; //!< Alias 1 region base address register (region RNR + 1).
+        volatile uint32_t RLAR_A1; //!< Alias 1 region limit address register (region RNR + 1).
+        volatile uint32_t RBAR_A2; //!< Alias 2 region base address register (region RNR + 2).
+        volatile uint32_t RLAR_A2; //!< Alias 2 region limit address register (region RNR + 2).
+        volatile uint32_t RBAR_A3; //!< Alias 3 region base address register (region RNR + 3).
+        volatile uint32_t RLAR_A3; //!< Alias 3 region limit address register (region RNR + 3).
+        volatile uint32_t RESERVED0;
+        volatile uint32_t MAIR0; //!< Memory attribute indirection register 0 (attribute indexes 0-3).
+        volatile uint32_t MAIR1; //!< Memory attribute indirection register 1 (attribute indexes 4-7).
+    };
+
+    //! Indicates whether the MPU is present, and if so, how many regions it supports.
+    union TYPE {
+        struct Bits {
+            uint32_t SEPARATE: 1; //!< Always 0, unified instruction and data regions.
+            uint32_t RESERVED0: 7;
+            uint32_t DREGION: 8; //!< Number of supported regions (0, 4, 8, 12 or 16).
+            uint32_t RESERVED1: 16;
+        } bits;
+
+        static constexpr Field<TYPE, 0, 1, FieldAccess::RO> SEPARATE_FIELD {};
+        static constexpr Field<TYPE, 8, 8, FieldAccess::RO> DREGION_FIELD {};
+
+        uint32_t value = 0;
+
+        TYPE() = default;
+
+        TYPE(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! MPU control register.
+    union CTRL {
+        struct Bits {
+            uint32_t ENABLE: 1; //!< Enable MPU.
+            uint32_t HFNMIENA: 1; //!< Enable MPU during HardFault and NMI.
+            uint32_t PRIVDEFENA: 1; //!< Enable default memory map for privileged access.
+            uint32_t RESERVED: 29;
+        } bits;
+
+        static constexpr Field<CTRL, 0, 1> ENABLE_FIELD {};
+        static constexpr Field<CTRL, 1, 1> HFNMIENA_FIELD {};
+        static constexpr Field<CTRL, 2, 1> PRIVDEFENA_FIELD {};
+
+        uint32_t value = 0;
+
+        CTRL() = default;
+
+        CTRL(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Region base address register.
+    union RBAR {
+        //! Access permission field values.
+        enum class AP : uint8_t {
+            PRIV_RW = 0b00, //!< Privileged read-write, unprivileged no access.
+            RW = 0b01, //!< Read-write.
+            PRIV_RO = 0b10, //!< Privileged read-only, unprivileged no access.
+            RO = 0b11 //!< Read-only.
+        };
+
+        //! Shareability field values (Normal memory only).
+        enum class SH : uint8_t {
+            NON_SHAREABLE = 0b00, //!< Non-shareable.
+            OUTER_SHAREABLE = 0b10, //!< Outer shareable.
+            INNER_SHAREABLE = 0b11 //!< Inner shareable.
+        };
+
+        struct Bits {
+            uint32_t XN: 1; //!< Instruction access disable.
+            uint32_t AP: 2; //!< Access permission.
+            uint32_t SH: 2; //!< Shareability.
+            uint32_t BASE: 27; //!< Region base address bits [31:5].
+        } bits;
+
+        static constexpr Field<RBAR, 0, 1> XN_FIELD {};
+        static constexpr Field<RBAR, 1, 2> AP_FIELD {};
+        static constexpr Field<RBAR, 3, 2> SH_FIELD {};
+        static constexpr Field<RBAR, 5, 27> BASE_FIELD {};
+
+        uint32_t value = 0;
+
+        RBAR() = default;
+
+        RBAR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Region limit address register.
+    union RLAR {
+        struct Bits {
+            uint32_t EN: 1; //!< Enable region.
+            uint32_t ATTRINDX: 3; //!< Index of the MAIR0/MAIR1 attribute byte used by the region.
+            uint32_t RESERVED: 1;
+            uint32_t LIMIT: 27; //!< Region limit address bits [31:5], bits [4:0] are implicitly 0x1F.
+        } bits;
+
+        static constexpr Field<RLAR, 0, 1> EN_FIELD {};
+        static constexpr Field<RLAR, 1, 3> ATTRINDX_FIELD {};
+        static constexpr Field<RLAR, 5, 27> LIMIT_FIELD {};
+
+        uint32_t value = 0;
+
+        RLAR() = default;
+
+        RLAR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Common MAIR attribute byte encodings.
+    //! Normal memory values set the same outer and inner attributes, with read and write allocation.
+    enum class MemoryAttributes : uint8_t {
+        DEVICE_NGNRNE = 0x00, //!< Device, non-gathering, non-reordering, no early write acknowledgement.
+        DEVICE_NGNRE = 0x04, //!< Device, non-gathering, non-reordering, early write acknowledgement.
+        DEVICE_NGRE = 0x08, //!< Device, non-gathering, reordering, early write acknowledgement.
+        DEVICE_GRE = 0x0C, //!< Device, gathering, reordering, early write acknowledgement.
+        NORMAL_NON_CACHEABLE = 0x44, //!< Normal, non-cacheable.
+        NORMAL_WRITE_THROUGH = 0xBB, //!< Normal, write-through non-transient.
+        NORMAL_WRITE_BACK = 0xFF //!< Normal, write-back non-transient.
+    };
+}
+
+namespace ArmCortex {
+    inline volatile Mpu::Registers* const MPU = reinterpret_cast<volatile Mpu::Registers*>(Mpu::BASE_ADDRESS);
+}
+
+namespace ArmCortex::Mpu {
+    //! Set one of the 8 attribute bytes referenced by RLAR.ATTRINDX.
+    [[gnu::always_inline]] static inline void setMemoryAttributes(uint8_t attr_index, MemoryAttributes attributes)
+    {
+        volatile uint32_t& mair = (attr_index < 4) ? MPU->MAIR0 : MPU->MAIR1;
+        const uint32_t shift = (attr_index % 4) * 8;
+        mair = (mair & ~(0xFFu << shift)) | (static_cast<uint32_t>(attributes) << shift);
+    }
+
+    //! Configure a region covering base_address to limit_address (both inclusive, 32-byte granularity).
+    //! Unlike PMSAv7, regions need not be power-of-two sized or aligned, but must not overlap.
+    [[gnu::always_inline]] static inline void configureRegion(uint8_t region_number, uint32_t base_address, uint32_t limit_address,
+        const RBAR& region_attributes, uint8_t attr_index)
+    {
+        MPU->RNR = region_number;
+
+        RBAR region_base = region_attributes;
+        region_base.bits.BASE = base_address >> 5;
+        MPU->RBAR = region_base.value;
+
+        RLAR region_limit;
+        region_limit.bits.EN = 1;
+        region_limit.bits.ATTRINDX = attr_index;
+        region_limit.bits.LIMIT = limit_address >> 5;
+        MPU->RLAR = region_limit.value;
+
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Disable a region, its registers keep their values.
+    [[gnu::always_inline]] static inline void disableRegion(uint8_t region_number)
+    {
+        MPU->RNR = region_number;
+        MPU->RLAR = MPU->RLAR & ~uint32_t{1};
+
+        asmDsb();
+        asmIsb();
+    }
+}
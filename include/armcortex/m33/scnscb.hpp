@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::ScnScb {
+    inline constexpr uintptr_t BASE_ADDRESS = 0xE000E000u;
+
+    struct Registers
+    {
+        volatile uint32_t RESERVED0; //!< Reserved.
+        volatile uint32_t ICTR; //!< Interrupt controller type register.
+        volatile uint32_t ACTLR; //!< Auxiliary control register.
+    };
+
+    //! Interrupt controller type register.
+    union ICTR {
+        struct Bits {
+            uint32_t INTLINESNUM: 4; //!< Number of implemented interrupt lines in groups of 32, minus one.
+            uint32_t RESERVED: 28;
+        } bits;
+
+        static constexpr Field<ICTR, 0, 4, FieldAccess::RO> INTLINESNUM_FIELD {};
+
+        uint32_t value = 0;
+
+        ICTR() = default;
+
+        ICTR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Auxiliary control register.
+    //! Trades performance for determinism or easier debugging, all bits are 0 (full performance) after reset.
+    //! Their cost can be measured with a cycle count around the affected code.
+    union ACTLR {
+        struct Bits {
+            //! Disable interruption of LDM/STM and multi-cycle multiply/divide instructions.
+            //! Interrupt latency grows by up to the length of the longest such instruction,
+            //! in exchange LDM/STM are never abandoned and restarted.
+            uint32_t DISMCYCINT: 1;
+            uint32_t RESERVED0: 1;
+            //! Disable IT instruction folding.
+            //! IT instructions then take a cycle of their own, making conditional code slightly slower.
+            uint32_t DISFOLD: 1;
+            uint32_t RESERVED1: 6;
+            //! Disable out-of-order completion of FP instructions.
+            //! Long FP operations (VDIV, VSQRT) then stall the pipeline instead of running in parallel with integer code.
+            uint32_t DISOOFP: 1;
+            //! Disable FPU exception outputs to the system.
+            uint32_t FPEXCODIS: 1;
+            uint32_t RESERVED2: 1;
+            //! Disable the ITM and DWT ATB flush.
+            uint32_t DISITMATBFLUSH: 1;
+            uint32_t RESERVED3: 16;
+            //! Treat all exclusive accesses as external, so the global exclusive monitor is always used.
+            uint32_t EXTEXCLALL: 1;
+            uint32_t RESERVED4: 2;
+        } bits;
+
+        static constexpr Field<ACTLR, 0, 1> DISMCYCINT_FIELD {};
+        static constexpr Field<ACTLR, 2, 1> DISFOLD_FIELD {};
+        static constexpr Field<ACTLR, 9, 1> DISOOFP_FIELD {};
+        static constexpr Field<ACTLR, 10, 1> FPEXCODIS_FIELD {};
+        static constexpr Field<ACTLR, 12, 1> DISITMATBFLUSH_FIELD {};
+        static constexpr Field<ACTLR, 29, 1> EXTEXCLALL_FIELD {};
+
+        uint32_t value = 0;
+
+        ACTLR() = default;
+
+        ACTLR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+}
+
+namespace ArmCortex {
+    inline volatile ScnScb::Registers* const SCN_SCB = reinterpret_cast<volatile ScnScb::Registers*>(ScnScb::BASE_ADDRESS);
+}
+
+namespace ArmCortex::ScnScb {
+    //! Number of implemented interrupt lines, rounded up to a multiple of 32.
+    [[gnu::always_inline]] static inline uint32_t getNumOfIrqLines()
+    {
+        return (read<ICTR>(SCN_SCB->ICTR, ICTR::INTLINESNUM_FIELD) + 1) * 32;
+    }
+}
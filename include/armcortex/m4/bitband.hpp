@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace ArmCortex::BitBand {
+    inline constexpr uintptr_t SRAM_BASE = 0x20000000u; //!< Start of the SRAM bit-band region.
+    inline constexpr uintptr_t SRAM_ALIAS_BASE = 0x22000000u; //!< Start of the SRAM bit-band alias region.
+    inline constexpr uintptr_t PERIPHERAL_BASE = 0x40000000u; //!< Start of the peripheral bit-band region.
+    inline constexpr uintptr_t PERIPHERAL_ALIAS_BASE = 0x42000000u; //!< Start of the peripheral bit-band alias region.
+    inline constexpr uintptr_t REGION_SIZE = 0x00100000u; //!< Size of each bit-band region (1 MB).
+
+    //! Check if the address lies in the SRAM or peripheral bit-band region.
+    constexpr bool isInRegion(uintptr_t address)
+    {
+        return ((address >= SRAM_BASE) && (address < SRAM_BASE + REGION_SIZE)) ||
+            ((address >= PERIPHERAL_BASE) && (address < PERIPHERAL_BASE + REGION_SIZE));
+    }
+
+    //! Alias word address of a bit in the bit-band region.
+    //! Each bit maps to one word: alias = alias base + byte offset * 32 + bit * 4.
+    constexpr uintptr_t aliasAddress(uintptr_t address, uint8_t bit)
+    {
+        uintptr_t byte_address = address + (bit / 8);
+        return (byte_address & 0xF0000000u) + 0x02000000u + ((byte_address & 0x000FFFFFu) << 5) + ((bit % 8) << 2);
+    }
+}
+
+namespace ArmCortex {
+    //! Reference to a single bit through its bit-band alias word.
+    //! Writes are atomic single-bit updates performed by the bus, without read-modify-write
+    //! or interrupt masking, so flags shared with ISRs need no critical section.
+    class BitBandRef {
+    public:
+        //! Reference from a precomputed alias address, see bitBandRef().
+        explicit constexpr BitBandRef(uintptr_t alias_address) :
+            m_alias_address(alias_address)
+        {
+        }
+
+        //! Reference to a bit of a word located in a bit-band region (e.g. a global flag word in SRAM).
+        //! \note The word must lie in the first 1 MB of SRAM or of the peripheral region.
+        BitBandRef(volatile uint32_t& word, uint8_t bit) :
+            m_alias_address(BitBand::aliasAddress(reinterpret_cast<uintptr_t>(&word), bit))
+        {
+        }
+
+        [[gnu::always_inline]] inline void set() const
+        {
+            *alias() = 1;
+        }
+
+        [[gnu::always_inline]] inline void clear() const
+        {
+            *alias() = 0;
+        }
+
+        [[gnu::always_inline]] inline void assign(bool state) const
+        {
+            *alias() = state;
+        }
+
+        [[gnu::always_inline]] inline bool isSet() const
+        {
+            return *alias() != 0;
+        }
+
+        constexpr uintptr_t aliasAddress() const
+        {
+            return m_alias_address;
+        }
+
+    private:
+        uintptr_t m_alias_address;
+
+        [[gnu::always_inline]] inline volatile uint32_t* alias() const
+        {
+            return reinterpret_cast<volatile uint32_t*>(m_alias_address);
+        }
+    };
+
+    //! Bit-band alias address of a bit at a fixed address, computed at compile time.
+    //! \tparam address Byte address in the SRAM or peripheral bit-band region.
+    //! \tparam bit Bit number counted from the address (0-31).
+    template<uintptr_t address, uint8_t bit>
+    constexpr uintptr_t bitBandAlias()
+    {
+        static_assert(bit < 32, "Bit number must be in range 0-31.");
+        static_assert(BitBand::isInRegion(address) && BitBand::isInRegion(address + (bit / 8)), "Address is not in a bit-band region.");
+        return BitBand::aliasAddress(address, bit);
+    }
+
+    //! Bit-band reference to a bit at a fixed address, computed at compile time.
+    template<uintptr_t address, uint8_t bit>
+    constexpr BitBandRef bitBandRef()
+    {
+        return BitBandRef(bitBandAlias<address, bit>());
+    }
+
+    //! Atomically sets the referenced bit.
+    [[gnu::always_inline]] static inline void setBit(BitBandRef ref)
+    {
+        ref.set();
+    }
+
+    //! Atomically clears the referenced bit.
+    [[gnu::always_inline]] static inline void clearBit(BitBandRef ref)
+    {
+        ref.clear();
+    }
+
+    //! Check if the referenced bit is set.
+    [[gnu::always_inline]] static inline bool isBitSet(BitBandRef ref)
+    {
+        return ref.isSet();
+    }
+}
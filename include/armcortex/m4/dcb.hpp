@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::Dcb {
+    inline constexpr uintptr_t BASE_ADDRESS = 0xE000EDF0u;
+
+    struct Registers {
+        volatile uint32_t DHCSR; //!< Debug halting control and status register.
+        volatile uint32_t DCRSR; //!< Debug core register selector register.
+        volatile uint32_t DCRDR; //!< Debug core register data register.
+        volatile uint32_t DEMCR; //!< Debug exception and monitor control register.
+    };
+
+    //! Debug halting control and status register.
+    union DHCSR {
+        static constexpr uint16_t DBGKEY_VALUE = 0xA05F; //!< Key required in bits [31:16] for every write.
+
+        struct Bits {
+            uint32_t C_DEBUGEN: 1; //!< Halting debug enabled (writable by the debugger only).
+            uint32_t C_HALT: 1; //!< Halt the processor.
+            uint32_t C_STEP: 1; //!< Single step the processor.
+            uint32_t C_MASKINTS: 1; //!< Mask PendSV, SysTick and external interrupts while stepping.
+            uint32_t RESERVED0: 1;
+            uint32_t C_SNAPSTALL: 1; //!< Break a stalled load or store to allow the processor to halt.
+            uint32_t RESERVED1: 10;
+            uint32_t S_REGRDY: 1; //!< Core register transfer through DCRSR/DCRDR has completed.
+            uint32_t S_HALT: 1; //!< Processor is halted in debug state.
+            uint32_t S_SLEEP: 1; //!< Processor is sleeping.
+            uint32_t S_LOCKUP: 1; //!< Processor is locked up.
+            uint32_t RESERVED2: 4;
+            uint32_t S_RETIRE_ST: 1; //!< An instruction has completed since last read (read clears).
+            uint32_t S_RESET_ST: 1; //!< The processor has been reset since last read (read clears).
+            uint32_t RESERVED3: 6;
+        } bits;
+
+        static constexpr Field<DHCSR, 0, 1> C_DEBUGEN_FIELD {};
+        static constexpr Field<DHCSR, 1, 1> C_HALT_FIELD {};
+        static constexpr Field<DHCSR, 2, 1> C_STEP_FIELD {};
+        static constexpr Field<DHCSR, 3, 1> C_MASKINTS_FIELD {};
+        static constexpr Field<DHCSR, 5, 1> C_SNAPSTALL_FIELD {};
+        static constexpr Field<DHCSR, 16, 1, FieldAccess::RO> S_REGRDY_FIELD {};
+        static constexpr Field<DHCSR, 17, 1, FieldAccess::RO> S_HALT_FIELD {};
+        static constexpr Field<DHCSR, 18, 1, FieldAccess::RO> S_SLEEP_FIELD {};
+        static constexpr Field<DHCSR, 19, 1, FieldAccess::RO> S_LOCKUP_FIELD {};
+        static constexpr Field<DHCSR, 24, 1, FieldAccess::RO> S_RETIRE_ST_FIELD {};
+        static constexpr Field<DHCSR, 25, 1, FieldAccess::RO> S_RESET_ST_FIELD {};
+        static constexpr uint32_t WRITE_KEY = uint32_t{DBGKEY_VALUE} << 16; //!< Inserted by modify() and write().
+        static constexpr uint32_t WRITE_KEY_MASK = 0xFFFF0000u;
+
+        uint32_t value = 0;
+
+        DHCSR() = default;
+
+        DHCSR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Debug exception and monitor control register.
+    union DEMCR {
+        struct Bits {
+            uint32_t VC_CORERESET: 1; //!< Halt on reset vector catch.
+            uint32_t RESERVED0: 3;
+            uint32_t VC_MMERR: 1; //!< Halt on MemManage exception.
+            uint32_t VC_NOCPERR: 1; //!< Halt on UsageFault caused by coprocessor access.
+            uint32_t VC_CHKERR: 1; //!< Halt on UsageFault caused by checking errors.
+            uint32_t VC_STATERR: 1; //!< Halt on UsageFault caused by state information errors.
+            uint32_t VC_BUSERR: 1; //!< Halt on BusFault.
+            uint32_t VC_INTERR: 1; //!< Halt on faults during exception entry or return.
+            uint32_t VC_HARDERR: 1; //!< Halt on HardFault.
+            uint32_t RESERVED1: 5;
+            uint32_t MON_EN: 1; //!< DebugMonitor exception enable.
+            uint32_t MON_PEND: 1; //!< DebugMonitor exception pending.
+            uint32_t MON_STEP: 1; //!< Single step from the DebugMonitor exception.
+            uint32_t MON_REQ: 1; //!< Software flag for the DebugMonitor handler, no hardware effect.
+            uint32_t RESERVED2: 4;
+            uint32_t TRCENA: 1; //!< Global enable of the DWT and ITM units.
+            uint32_t RESERVED3: 7;
+        } bits;
+
+        static constexpr Field<DEMCR, 0, 1> VC_CORERESET_FIELD {};
+        static constexpr Field<DEMCR, 4, 1> VC_MMERR_FIELD {};
+        static constexpr Field<DEMCR, 5, 1> VC_NOCPERR_FIELD {};
+        static constexpr Field<DEMCR, 6, 1> VC_CHKERR_FIELD {};
+        static constexpr Field<DEMCR, 7, 1> VC_STATERR_FIELD {};
+        static constexpr Field<DEMCR, 8, 1> VC_BUSERR_FIELD {};
+        static constexpr Field<DEMCR, 9, 1> VC_INTERR_FIELD {};
+        static constexpr Field<DEMCR, 10, 1> VC_HARDERR_FIELD {};
+        static constexpr Field<DEMCR, 16, 1> MON_EN_FIELD {};
+        static constexpr Field<DEMCR, 17, 1> MON_PEND_FIELD {};
+        static constexpr Field<DEMCR, 18, 1> MON_STEP_FIELD {};
+        static constexpr Field<DEMCR, 19, 1> MON_REQ_FIELD {};
+        static constexpr Field<DEMCR, 24, 1> TRCENA_FIELD {};
+
+        uint32_t value = 0;
+
+        DEMCR() = default;
+
+        DEMCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+}
+
+namespace ArmCortex {
+    inline volatile Dcb::Registers* const DCB = reinterpret_cast<volatile Dcb::Registers*>(Dcb::BASE_ADDRESS);
+}
+
+namespace ArmCortex::Dcb {
+    //! Enable the DWT and ITM units (DEMCR.TRCENA).
+    //! \note Needed before any DWT or ITM register is usable, a debugger may or may not have set it.
+    [[gnu::always_inline]] static inline void enableTrace()
+    {
+        modify<DEMCR>(DCB->DEMCR, DEMCR::TRCENA_FIELD(1));
+    }
+}
@@ -0,0 +1,138 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/m4/dcb.hpp"
+#include "armcortex/m4/dwt.hpp"
+#include "armcortex/m4/scb.hpp"
+#include "armcortex/register_field.hpp"
+#include "armcortex/svc.hpp"
+#include <cstdint>
+
+namespace ArmCortex::DebugMonitor {
+    //! Enable the DebugMonitor exception, so DWT watchpoint hits are handled in software without halting.
+    //! Also enables trace (DEMCR.TRCENA) for the DWT comparators.
+    //! \note Has no effect while a debugger has halting debug enabled (DHCSR.C_DEBUGEN), hits halt the core instead.
+    [[gnu::always_inline]] static inline void enable()
+    {
+        modify<Dcb::DEMCR>(DCB->DEMCR, Dcb::DEMCR::MON_EN_FIELD(1), Dcb::DEMCR::TRCENA_FIELD(1));
+    }
+
+    //! Disable the DebugMonitor exception.
+    [[gnu::always_inline]] static inline void disable()
+    {
+        modify<Dcb::DEMCR>(DCB->DEMCR, Dcb::DEMCR::MON_EN_FIELD(0));
+    }
+
+    //! Watchpoint hit recorded by the DebugMonitor handler.
+    struct Hit {
+        uint32_t pc; //!< Stacked return address, a few instructions past the access for data watchpoints.
+        uint8_t comparators; //!< Bit mask of the comparators that matched.
+    };
+
+    //! Ring buffer of the most recent watchpoint hits, oldest entries are overwritten.
+    //! \tparam capacity Number of kept hits.
+    template<uint32_t capacity>
+    class HitLog {
+    public:
+        static_assert(capacity > 0, "Hit log needs at least one entry.");
+
+        //! Record a hit, called by the DebugMonitor handler.
+        void record(const Hit& hit)
+        {
+            uint32_t total = m_total;
+            m_hits[total % capacity] = hit;
+            m_total = total + 1;
+        }
+
+        //! Number of hits since start-up, including overwritten ones.
+        uint32_t total() const
+        {
+            return m_total;
+        }
+
+        //! Number of hits currently kept.
+        uint32_t size() const
+        {
+            return (m_total < capacity) ? m_total : capacity;
+        }
+
+        //! Kept hit, 0 being the oldest.
+        const Hit& operator[](uint32_t index) const
+        {
+            uint32_t first = (m_total < capacity) ? 0 : (m_total % capacity);
+            return m_hits[(first + index) % capacity];
+        }
+
+    private:
+        Hit m_hits[capacity] = {};
+        volatile uint32_t m_total = 0;
+    };
+
+    //! Record DWT watchpoint hits into log and acknowledge the debug event.
+    //! Other debug events (BKPT, vector catch) are only acknowledged.
+    //! \tparam log HitLog instance.
+    template<auto& log>
+    void handle(Svc::StackFrame* frame)
+    {
+        uint32_t dfsr = SCB->DFSR;
+
+        if (Scb::DFSR::DWTTRAP_FIELD.get(dfsr) != 0) {
+            uint8_t comparators = 0;
+            uint8_t num_of_comparators = Dwt::getNumOfComparators();
+
+            for (uint8_t comparator = 0; comparator < num_of_comparators; comparator++) {
+                if (Dwt::isMatched(comparator)) {
+                    comparators |= static_cast<uint8_t>(1u << comparator);
+                }
+            }
+
+            log.record(Hit { frame->pc, comparators });
+        }
+
+        SCB->DFSR = dfsr;
+    }
+
+    //! DebugMonitor exception entry. Call it as the only statement of a naked DebugMon_Handler:
+    //! \code
+    //! ArmCortex::DebugMonitor::HitLog<16> watch_log;
+    //! extern "C" [[gnu::naked]] void DebugMon_Handler() { ArmCortex::DebugMonitor::handlerEntry<watch_log>(); }
+    //! \endcode
+    //! Selects MSP or PSP from EXC_RETURN bit 2 with the same sequence as Svc::handlerEntry() and passes
+    //! the stack frame to handle().
+    //! The normal code path is not instrumented, the only cost is the exception taken on a hit.
+    template<auto& log>
+    [[gnu::always_inline]] static inline void handlerEntry()
+    {
+        asm volatile(
+            "movs r0, #4\n\t"
+            "mov r1, lr\n\t"
+            "tst r0, r1\n\t"
+            "beq 1f\n\t"
+            "mrs r0, psp\n\t"
+            "b 2f\n"
+            "1:\n\t"
+            "mrs r0, msp\n"
+            "2:\n\t"
+            "push {r4, lr}\n\t"
+            "bl %c0\n\t"
+            "pop {r4, pc}"
+            : : "i" (&handle<log>)
+        );
+    }
+}
@@ -0,0 +1,485 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/m4/dcb.hpp"
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::Dwt {
+    inline constexpr uintptr_t BASE_ADDRESS = 0xE0001000u;
+    inline constexpr uint8_t MAX_NUM_OF_COMPARATORS = 4;
+
+    //! Comparator register set.
+    struct Comparator {
+        volatile uint32_t COMP; //!< Comparator register (address or data value to match).
+        volatile uint32_t MASK; //!< Number of address bits ignored by the comparison.
+        volatile uint32_t FUNCTION; //!< Comparator function register.
+        volatile uint32_t RESERVED;
+    };
+
+    struct Registers {
+        volatile uint32_t CTRL; //!< Control register.
+        volatile uint32_t CYCCNT; //!< Cycle count register.
+        volatile uint32_t CPICNT; //!< CPI count register (8-bit, extra cycles of multi-cycle instructions).
+        volatile uint32_t EXCCNT; //!< Exception overhead count register (8-bit).
+        volatile uint32_t SLEEPCNT; //!< Sleep count register (8-bit).
+        volatile uint32_t LSUCNT; //!< LSU count register (8-bit, extra cycles of load and store instructions).
+        volatile uint32_t FOLDCNT; //!< Folded instruction count register (8-bit).
+        volatile uint32_t PCSR; //!< Program counter sample register.
+        Comparator COMPARATORS[MAX_NUM_OF_COMPARATORS]; //!< Comparators, see CTRL.NUMCOMP for the implemented number.
+    };
+
+    //! Control register.
+    union CTRL {
+        struct Bits {
+            uint32_t CYCCNTENA: 1; //!< Enable the CYCCNT counter.
+            uint32_t POSTPRESET: 4; //!< Reload value of the POSTCNT counter.
+            uint32_t POSTINIT: 4; //!< Initial value of the POSTCNT counter.
+            uint32_t CYCTAP: 1; //!< POSTCNT tap on CYCCNT (0: bit 6, 1: bit 10).
+            uint32_t SYNCTAP: 2; //!< Synchronisation packet rate tap on CYCCNT (0: disabled).
+            uint32_t PCSAMPLENA: 1; //!< Enable periodic PC sample packets.
+            uint32_t RESERVED0: 3;
+            uint32_t EXCTRCENA: 1; //!< Enable exception trace packets.
+            uint32_t CPIEVTENA: 1; //!< Enable CPICNT counter and overflow events.
+            uint32_t EXCEVTENA: 1; //!< Enable EXCCNT counter and overflow events.
+            uint32_t SLEEPEVTENA: 1; //!< Enable SLEEPCNT counter and overflow events.
+            uint32_t LSUEVTENA: 1; //!< Enable LSUCNT counter and overflow events.
+            uint32_t FOLDEVTENA: 1; //!< Enable FOLDCNT counter and overflow events.
+            uint32_t CYCEVTENA: 1; //!< Enable POSTCNT underflow events.
+            uint32_t RESERVED1: 1;
+            uint32_t NOPRFCNT: 1; //!< Profiling counters are not implemented.
+            uint32_t NOCYCCNT: 1; //!< Cycle counter is not implemented.
+            uint32_t NOEXTTRIG: 1; //!< External match signals are not implemented.
+            uint32_t NOTRCPKT: 1; //!< Trace sampling and exception tracing are not implemented.
+            uint32_t NUMCOMP: 4; //!< Number of implemented comparators.
+        } bits;
+
+        static constexpr Field<CTRL, 0, 1> CYCCNTENA_FIELD {};
+        static constexpr Field<CTRL, 1, 4> POSTPRESET_FIELD {};
+        static constexpr Field<CTRL, 5, 4> POSTINIT_FIELD {};
+        static constexpr Field<CTRL, 9, 1> CYCTAP_FIELD {};
+        static constexpr Field<CTRL, 10, 2> SYNCTAP_FIELD {};
+        static constexpr Field<CTRL, 12, 1> PCSAMPLENA_FIELD {};
+        static constexpr Field<CTRL, 16, 1> EXCTRCENA_FIELD {};
+        static constexpr Field<CTRL, 17, 1> CPIEVTENA_FIELD {};
+        static constexpr Field<CTRL, 18, 1> EXCEVTENA_FIELD {};
+        static constexpr Field<CTRL, 19, 1> SLEEPEVTENA_FIELD {};
+        static constexpr Field<CTRL, 20, 1> LSUEVTENA_FIELD {};
+        static constexpr Field<CTRL, 21, 1> FOLDEVTENA_FIELD {};
+        static constexpr Field<CTRL, 22, 1> CYCEVTENA_FIELD {};
+        static constexpr Field<CTRL, 24, 1, FieldAccess::RO> NOPRFCNT_FIELD {};
+        static constexpr Field<CTRL, 25, 1, FieldAccess::RO> NOCYCCNT_FIELD {};
+        static constexpr Field<CTRL, 26, 1, FieldAccess::RO> NOEXTTRIG_FIELD {};
+        static constexpr Field<CTRL, 27, 1, FieldAccess::RO> NOTRCPKT_FIELD {};
+        static constexpr Field<CTRL, 28, 4, FieldAccess::RO> NUMCOMP_FIELD {};
+
+        uint32_t value = 0;
+
+        CTRL() = default;
+
+        CTRL(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Comparator mask register.
+    union MASK {
+        struct Bits {
+            uint32_t MASK: 5; //!< Number of low address bits ignored by the comparison (size of the watched range is 2^MASK bytes).
+            uint32_t RESERVED: 27;
+        } bits;
+
+        static constexpr Field<MASK, 0, 5> MASK_FIELD {};
+
+        uint32_t value = 0;
+
+        MASK() = default;
+
+        MASK(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Comparator function register.
+    union FUNCTION {
+        //! Action on comparator match.
+        enum class Function : uint8_t {
+            DISABLED = 0b0000, //!< Comparator disabled.
+            PC_SAMPLE = 0b0001, //!< Emit a PC sample packet (or compare against CYCCNT if CYCMATCH is set).
+            DATA_VALUE = 0b0010, //!< Emit a data value packet.
+            PC_AND_DATA_VALUE = 0b0011, //!< Emit PC sample and data value packets.
+            WATCH_PC = 0b0100, //!< Watchpoint on instruction fetch.
+            WATCH_READ = 0b0101, //!< Watchpoint on data read.
+            WATCH_WRITE = 0b0110, //!< Watchpoint on data write.
+            WATCH_READ_WRITE = 0b0111, //!< Watchpoint on data read or write.
+            CMPMATCH_PC = 0b1000, //!< ETM trigger on instruction fetch.
+            CMPMATCH_READ = 0b1001, //!< ETM trigger on data read.
+            CMPMATCH_WRITE = 0b1010, //!< ETM trigger on data write.
+            CMPMATCH_READ_WRITE = 0b1011 //!< ETM trigger on data read or write.
+        };
+
+        //! Size of the data value compared when DATAVMATCH is set.
+        enum class DataSize : uint8_t {
+            BYTE = 0b00, //!< 8-bit.
+            HALFWORD = 0b01, //!< 16-bit.
+            WORD = 0b10 //!< 32-bit.
+        };
+
+        struct Bits {
+            uint32_t FUNCTION: 4; //!< Action on match.
+            uint32_t RESERVED0: 1;
+            uint32_t EMITRANGE: 1; //!< Emit data address offset instead of full address in trace packets.
+            uint32_t RESERVED1: 1;
+            uint32_t CYCMATCH: 1; //!< Compare against CYCCNT (comparator 0 only).
+            uint32_t DATAVMATCH: 1; //!< Compare against the data value (comparator 1 only).
+            uint32_t LNK1ENA: 1; //!< Second linked comparator is supported.
+            uint32_t DATAVSIZE: 2; //!< Size of the compared data value.
+            uint32_t DATAVADDR0: 4; //!< Number of the first linked address comparator.
+            uint32_t DATAVADDR1: 4; //!< Number of the second linked address comparator.
+            uint32_t RESERVED2: 4;
+            uint32_t MATCHED: 1; //!< Comparator matched since last read (read clears).
+            uint32_t RESERVED3: 7;
+        } bits;
+
+        static constexpr Field<FUNCTION, 0, 4> FUNCTION_FIELD {};
+        static constexpr Field<FUNCTION, 5, 1> EMITRANGE_FIELD {};
+        static constexpr Field<FUNCTION, 7, 1> CYCMATCH_FIELD {};
+        static constexpr Field<FUNCTION, 8, 1> DATAVMATCH_FIELD {};
+        static constexpr Field<FUNCTION, 9, 1, FieldAccess::RO> LNK1ENA_FIELD {};
+        static constexpr Field<FUNCTION, 10, 2> DATAVSIZE_FIELD {};
+        static constexpr Field<FUNCTION, 12, 4> DATAVADDR0_FIELD {};
+        static constexpr Field<FUNCTION, 16, 4> DATAVADDR1_FIELD {};
+        static constexpr Field<FUNCTION, 24, 1, FieldAccess::RO> MATCHED_FIELD {};
+
+        uint32_t value = 0;
+
+        FUNCTION() = default;
+
+        FUNCTION(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+}
+
+namespace ArmCortex {
+    inline volatile Dwt::Registers* const DWT = reinterpret_cast<volatile Dwt::Registers*>(Dwt::BASE_ADDRESS);
+}
+
+namespace ArmCortex::Dwt {
+    //! Check if the cycle counter is implemented.
+    //! \note Requires DEMCR.TRCENA, see Dcb::enableTrace().
+    [[gnu::always_inline]] static inline bool hasCycleCounter()
+    {
+        return read<CTRL>(DWT->CTRL, CTRL::NOCYCCNT_FIELD) == 0;
+    }
+
+    //! Number of implemented comparators.
+    //! \note Requires DEMCR.TRCENA, see Dcb::enableTrace().
+    [[gnu::always_inline]] static inline uint8_t getNumOfComparators()
+    {
+        return static_cast<uint8_t>(read<CTRL>(DWT->CTRL, CTRL::NUMCOMP_FIELD));
+    }
+
+    //! Enable trace (DEMCR.TRCENA), reset CYCCNT and start it counting processor clock cycles.
+    [[gnu::always_inline]] static inline void enableCycleCounter()
+    {
+        Dcb::enableTrace();
+        DWT->CYCCNT = 0;
+        modify<CTRL>(DWT->CTRL, CTRL::CYCCNTENA_FIELD(1));
+    }
+
+    //! Stop CYCCNT, keeping its value.
+    [[gnu::always_inline]] static inline void disableCycleCounter()
+    {
+        modify<CTRL>(DWT->CTRL, CTRL::CYCCNTENA_FIELD(0));
+    }
+
+    //! Current CYCCNT value, wraps around after 2^32 cycles.
+    [[gnu::always_inline]] static inline uint32_t getCycleCount()
+    {
+        return DWT->CYCCNT;
+    }
+
+    //! Measures the processor cycles spent during its lifetime and stores them on destruction.
+    //! The overhead of the measurement itself, as found by calibrate(), is subtracted, so an empty
+    //! scope yields 0. Compiler barriers keep the measured code between the two CYCCNT reads.
+    //! \note The cycle counter must be running, see enableCycleCounter().
+    class CycleScope {
+    public:
+        [[gnu::always_inline]] explicit CycleScope(uint32_t& cycles) :
+            m_cycles(cycles)
+        {
+            compilerBarrier();
+            m_start = DWT->CYCCNT;
+            compilerBarrier();
+        }
+
+        [[gnu::always_inline]] ~CycleScope()
+        {
+            compilerBarrier();
+            uint32_t elapsed = DWT->CYCCNT - m_start;
+            compilerBarrier();
+            m_cycles = (elapsed > s_overhead) ? (elapsed - s_overhead) : 0;
+        }
+
+        CycleScope(const CycleScope&) = delete;
+        CycleScope& operator=(const CycleScope&) = delete;
+
+        //! Measure an empty scope and use its cost as the overhead subtracted from all later measurements.
+        //! Takes the minimum of several runs to exclude interrupts. Call once after enableCycleCounter().
+        //! \return Measured overhead in cycles.
+        static uint32_t calibrate()
+        {
+            constexpr uint8_t NUM_OF_RUNS = 8;
+
+            s_overhead = 0;
+            uint32_t minimum = UINT32_MAX;
+
+            for (uint8_t run = 0; run < NUM_OF_RUNS; run++) {
+                uint32_t cycles;
+                {
+                    CycleScope scope(cycles);
+                }
+                if (cycles < minimum) {
+                    minimum = cycles;
+                }
+            }
+
+            s_overhead = minimum;
+            return minimum;
+        }
+
+        //! Overhead in cycles subtracted from every measurement.
+        static uint32_t overhead()
+        {
+            return s_overhead;
+        }
+
+    private:
+        inline static uint32_t s_overhead = 0;
+
+        uint32_t& m_cycles;
+        uint32_t m_start;
+    };
+
+    //! Enable trace, reset CYCCNT and the 8-bit profiling counters and start them all counting.
+    //! Setting the event enables also makes each 8-bit counter emit an overflow event packet when
+    //! trace output is configured.
+    [[gnu::always_inline]] static inline void enablePerfCounters()
+    {
+        Dcb::enableTrace();
+        DWT->CYCCNT = 0;
+        DWT->CPICNT = 0;
+        DWT->EXCCNT = 0;
+        DWT->SLEEPCNT = 0;
+        DWT->LSUCNT = 0;
+        DWT->FOLDCNT = 0;
+        modify<CTRL>(DWT->CTRL, CTRL::CYCCNTENA_FIELD(1), CTRL::CPIEVTENA_FIELD(1), CTRL::EXCEVTENA_FIELD(1),
+            CTRL::SLEEPEVTENA_FIELD(1), CTRL::LSUEVTENA_FIELD(1), CTRL::FOLDEVTENA_FIELD(1));
+    }
+
+    //! Stop the 8-bit profiling counters, CYCCNT keeps running.
+    [[gnu::always_inline]] static inline void disablePerfCounters()
+    {
+        modify<CTRL>(DWT->CTRL, CTRL::CPIEVTENA_FIELD(0), CTRL::EXCEVTENA_FIELD(0), CTRL::SLEEPEVTENA_FIELD(0),
+            CTRL::LSUEVTENA_FIELD(0), CTRL::FOLDEVTENA_FIELD(0));
+    }
+
+    //! Cycles spent in a code region, split by category.
+    struct PerfBreakdown {
+        uint32_t cycles = 0; //!< Total processor cycles.
+        uint32_t cpi = 0; //!< Extra cycles of multi-cycle instructions, excluding load and store.
+        uint32_t exception = 0; //!< Cycles of exception entry and exit overhead.
+        uint32_t sleep = 0; //!< Cycles spent sleeping.
+        uint32_t lsu = 0; //!< Extra cycles of load and store instructions, including bus wait states.
+        uint32_t folded = 0; //!< Instructions executed in zero cycles.
+
+        //! Number of executed instructions.
+        constexpr uint32_t instructions() const
+        {
+            return cycles - cpi - exception - sleep - lsu + folded;
+        }
+
+        constexpr PerfBreakdown& operator+=(const PerfBreakdown& other)
+        {
+            cycles += other.cycles;
+            cpi += other.cpi;
+            exception += other.exception;
+            sleep += other.sleep;
+            lsu += other.lsu;
+            folded += other.folded;
+            return *this;
+        }
+    };
+
+    //! Snapshot of CYCCNT and the 8-bit profiling counters.
+    struct PerfCounters {
+        uint32_t cycles = 0;
+        uint8_t cpi = 0;
+        uint8_t exception = 0;
+        uint8_t sleep = 0;
+        uint8_t lsu = 0;
+        uint8_t folded = 0;
+
+        //! Read all counters.
+        //! \note The counters must be running, see enablePerfCounters().
+        [[gnu::always_inline]] static inline PerfCounters capture()
+        {
+            PerfCounters counters;
+            counters.cycles = DWT->CYCCNT;
+            counters.cpi = static_cast<uint8_t>(DWT->CPICNT);
+            counters.exception = static_cast<uint8_t>(DWT->EXCCNT);
+            counters.sleep = static_cast<uint8_t>(DWT->SLEEPCNT);
+            counters.lsu = static_cast<uint8_t>(DWT->LSUCNT);
+            counters.folded = static_cast<uint8_t>(DWT->FOLDCNT);
+            return counters;
+        }
+    };
+
+    //! Counts between two snapshots.
+    //! The 8-bit counters are subtracted modulo 256, so each must advance by less than 256 between
+    //! the snapshots. Longer regions are measured with PerfMonitor.
+    constexpr PerfBreakdown diff(const PerfCounters& begin, const PerfCounters& end)
+    {
+        PerfBreakdown breakdown;
+        breakdown.cycles = end.cycles - begin.cycles;
+        breakdown.cpi = static_cast<uint8_t>(end.cpi - begin.cpi);
+        breakdown.exception = static_cast<uint8_t>(end.exception - begin.exception);
+        breakdown.sleep = static_cast<uint8_t>(end.sleep - begin.sleep);
+        breakdown.lsu = static_cast<uint8_t>(end.lsu - begin.lsu);
+        breakdown.folded = static_cast<uint8_t>(end.folded - begin.folded);
+        return breakdown;
+    }
+
+    //! Accumulates the profiling counters into 32-bit totals.
+    //! The DWT overflow events are only visible to an external trace tool, so overflows are
+    //! handled by calling update() often enough that no 8-bit counter advances by 256 or more
+    //! in between, e.g. from a periodic timer interrupt.
+    class PerfMonitor {
+    public:
+        //! Take the initial snapshot and clear the totals.
+        void start()
+        {
+            m_last = PerfCounters::capture();
+            m_totals = PerfBreakdown{};
+        }
+
+        //! Add the counts since the previous start() or update() to the totals.
+        void update()
+        {
+            PerfCounters now = PerfCounters::capture();
+            m_totals += diff(m_last, now);
+            m_last = now;
+        }
+
+        //! Totals accumulated until the last update().
+        constexpr const PerfBreakdown& totals() const
+        {
+            return m_totals;
+        }
+
+    private:
+        PerfCounters m_last;
+        PerfBreakdown m_totals;
+    };
+
+    //! Data access type that triggers a watchpoint.
+    enum class Access : uint8_t {
+        READ = static_cast<uint8_t>(FUNCTION::Function::WATCH_READ), //!< Data reads.
+        WRITE = static_cast<uint8_t>(FUNCTION::Function::WATCH_WRITE), //!< Data writes.
+        READ_WRITE = static_cast<uint8_t>(FUNCTION::Function::WATCH_READ_WRITE) //!< Data reads and writes.
+    };
+
+    //! Disable a comparator.
+    [[gnu::always_inline]] static inline void disableComparator(uint8_t comparator)
+    {
+        DWT->COMPARATORS[comparator].FUNCTION = 0;
+    }
+
+    //! Watch data accesses to an address range.
+    //! A hit raises the DebugMonitor exception (see DebugMonitor::enable()) or halts the core when a debugger
+    //! has enabled halting debug. Data watchpoints are imprecise, the stacked PC points a few instructions past the access.
+    //! \param comparator Comparator number, less than getNumOfComparators().
+    //! \param address Start of the watched range, aligned to its size.
+    //! \param size_log2 Size of the watched range as a power of two, 0 for a single byte (at most 31, often less is implemented).
+    //! \param access Access type to watch.
+    [[gnu::always_inline]] static inline void setDataWatchpoint(uint8_t comparator, uintptr_t address, uint8_t size_log2, Access access)
+    {
+        disableComparator(comparator);
+        DWT->COMPARATORS[comparator].COMP = address;
+        write<MASK>(DWT->COMPARATORS[comparator].MASK, MASK::MASK_FIELD(size_log2));
+        write<FUNCTION>(DWT->COMPARATORS[comparator].FUNCTION, FUNCTION::FUNCTION_FIELD(access));
+    }
+
+    //! Watch accesses of a specific value to an address.
+    //! Uses comparator 1, the only one with data value matching, linked to address_comparator which holds the address.
+    //! \param address_comparator Comparator number used for the address match, must not be 1.
+    //! \param address Watched address, aligned to the data size.
+    //! \param value Data value to match.
+    //! \param size Size of the watched data.
+    //! \param access Access type to watch.
+    [[gnu::always_inline]] static inline void setDataValueWatchpoint(uint8_t address_comparator, uintptr_t address, uint32_t value,
+        FUNCTION::DataSize size, Access access)
+    {
+        constexpr uint8_t VALUE_COMPARATOR = 1;
+
+        // The matched value is replicated over the whole comparator register for byte and halfword sizes.
+        if (size == FUNCTION::DataSize::BYTE) {
+            value = (value & 0xFFu) * 0x01010101u;
+        } else if (size == FUNCTION::DataSize::HALFWORD) {
+            value = (value & 0xFFFFu) * 0x00010001u;
+        }
+
+        disableComparator(VALUE_COMPARATOR);
+        disableComparator(address_comparator);
+        DWT->COMPARATORS[address_comparator].COMP = address;
+        DWT->COMPARATORS[address_comparator].MASK = 0;
+        DWT->COMPARATORS[VALUE_COMPARATOR].COMP = value;
+        write<FUNCTION>(DWT->COMPARATORS[VALUE_COMPARATOR].FUNCTION, FUNCTION::FUNCTION_FIELD(access), FUNCTION::DATAVMATCH_FIELD(1),
+            FUNCTION::DATAVSIZE_FIELD(size), FUNCTION::DATAVADDR0_FIELD(address_comparator), FUNCTION::DATAVADDR1_FIELD(address_comparator));
+    }
+
+    //! Watch instruction fetches from an address.
+    //! \param comparator Comparator number, less than getNumOfComparators().
+    //! \param pc Instruction address (the Thumb bit is ignored).
+    [[gnu::always_inline]] static inline void setPcWatchpoint(uint8_t comparator, uintptr_t pc)
+    {
+        disableComparator(comparator);
+        DWT->COMPARATORS[comparator].COMP = pc & ~uintptr_t{1u};
+        DWT->COMPARATORS[comparator].MASK = 0;
+        write<FUNCTION>(DWT->COMPARATORS[comparator].FUNCTION, FUNCTION::FUNCTION_FIELD(FUNCTION::Function::WATCH_PC));
+    }
+
+    //! Check and clear the match flag of a comparator (reading FUNCTION clears MATCHED).
+    [[gnu::always_inline]] static inline bool isMatched(uint8_t comparator)
+    {
+        return read<FUNCTION>(DWT->COMPARATORS[comparator].FUNCTION, FUNCTION::MATCHED_FIELD) != 0;
+    }
+
+    //! Non-intrusive sample of the currently executing instruction address.
+    //! \return Sampled PC, 0xFFFFFFFF when the core is halted or sampling is not implemented.
+    [[gnu::always_inline]] static inline uint32_t samplePc()
+    {
+        return DWT->PCSR;
+    }
+}
@@ -16,11 +16,23 @@
 
 #pragma once
 
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/m4/scb.hpp"
+#include "armcortex/m4/special_regs.hpp"
+#include "armcortex/register_field.hpp"
 #include <cstdint>
 
 namespace ArmCortex::Fpu {
     inline constexpr uintptr_t BASE_ADDRESS = 0xE000EF34u;
 
+#if defined(__ARM_PCS_VFP)
+    inline constexpr bool IS_HARD_FLOAT_ABI = true;
+#else
+    inline constexpr bool IS_HARD_FLOAT_ABI = false;
+#endif
+
+    static_assert(IS_HARD_FLOAT_ABI, "Cortex-M4 FPU support requires a hard-float ABI build (-mfpu=fpv4-sp-d16 -mfloat-abi=hard).");
+
     struct Registers {
         volatile uint32_t FPCCR; //!< Floating-point context control register.
         volatile uint32_t FPCAR; //!< Floating-point context address register.
@@ -47,6 +59,16 @@ namespace ArmCortex::Fpu {
             uint32_t ASPEN: 1; //!< Automatic state preservation enable (CONTROL.FPCA set on FP instruction).
         } bits;
 
+        static constexpr Field<FPCCR, 0, 1> LSPACT_FIELD {};
+        static constexpr Field<FPCCR, 1, 1> USER_FIELD {};
+        static constexpr Field<FPCCR, 3, 1> THREAD_FIELD {};
+        static constexpr Field<FPCCR, 4, 1> HFRDY_FIELD {};
+        static constexpr Field<FPCCR, 5, 1> MMRDY_FIELD {};
+        static constexpr Field<FPCCR, 6, 1> BFRDY_FIELD {};
+        static constexpr Field<FPCCR, 8, 1> MONRDY_FIELD {};
+        static constexpr Field<FPCCR, 30, 1> LSPEN_FIELD {};
+        static constexpr Field<FPCCR, 31, 1> ASPEN_FIELD {};
+
         uint32_t value = 0;
 
         FPCCR() = default;
@@ -65,6 +87,8 @@ namespace ArmCortex::Fpu {
             uint32_t ADDRESS: 29; //!< Address of unpopulated FP register space (8-byte aligned).
         } bits;
 
+        static constexpr Field<FPCAR, 3, 29> ADDRESS_FIELD {};
+
         uint32_t value = 0;
 
         FPCAR() = default;
@@ -95,6 +119,11 @@ namespace ArmCortex::Fpu {
             uint32_t RESERVED1: 5;
         } bits;
 
+        static constexpr Field<FPDSCR, 22, 2> RMODE_FIELD {};
+        static constexpr Field<FPDSCR, 24, 1> FZ_FIELD {};
+        static constexpr Field<FPDSCR, 25, 1> DN_FIELD {};
+        static constexpr Field<FPDSCR, 26, 1> AHP_FIELD {};
+
         uint32_t value = 0;
 
         FPDSCR() = default;
@@ -159,6 +188,15 @@ namespace ArmCortex::Fpu {
             uint32_t VFP_ROUNDING_MODES: 4; //!< VFP rounding modes support.
         } bits;
 
+        static constexpr Field<MVFR0, 0, 4, FieldAccess::RO> A_SIMD_REGISTERS_FIELD {};
+        static constexpr Field<MVFR0, 4, 4, FieldAccess::RO> SINGLE_PRECISION_FIELD {};
+        static constexpr Field<MVFR0, 8, 4, FieldAccess::RO> DOUBLE_PRECISION_FIELD {};
+        static constexpr Field<MVFR0, 12, 4, FieldAccess::RO> VFP_EXCEPTION_TRAPPING_FIELD {};
+        static constexpr Field<MVFR0, 16, 4, FieldAccess::RO> DIVIDE_FIELD {};
+        static constexpr Field<MVFR0, 20, 4, FieldAccess::RO> SQUARE_ROOT_FIELD {};
+        static constexpr Field<MVFR0, 24, 4, FieldAccess::RO> SHORT_VECTORS_FIELD {};
+        static constexpr Field<MVFR0, 28, 4, FieldAccess::RO> VFP_ROUNDING_MODES_FIELD {};
+
         uint32_t value = 0;
 
         MVFR0() = default;
@@ -205,6 +243,11 @@ namespace ArmCortex::Fpu {
             uint32_t FP_FUSED_MAC: 4; //!< FP fused multiply-accumulate support.
         } bits;
 
+        static constexpr Field<MVFR1, 0, 4, FieldAccess::RO> FTZ_MODE_FIELD {};
+        static constexpr Field<MVFR1, 4, 4, FieldAccess::RO> D_NAN_MODE_FIELD {};
+        static constexpr Field<MVFR1, 24, 4, FieldAccess::RO> FP_HPFP_FIELD {};
+        static constexpr Field<MVFR1, 28, 4, FieldAccess::RO> FP_FUSED_MAC_FIELD {};
+
         uint32_t value = 0;
 
         MVFR1() = default;
@@ -219,3 +262,117 @@ namespace ArmCortex::Fpu {
 namespace ArmCortex {
     inline volatile Fpu::Registers* const FPU = reinterpret_cast<volatile Fpu::Registers*>(Fpu::BASE_ADDRESS);
 }
+
+namespace ArmCortex::Fpu {
+    //! Floating-point context preservation on exception entry.
+    enum class StatePreservation : uint8_t {
+        NONE, //!< No automatic preservation (ASPEN = 0, LSPEN = 0), handlers must save FP context themselves.
+        EAGER, //!< S0-S15 and FPSCR are always stacked on exception entry (ASPEN = 1, LSPEN = 0).
+        LAZY //!< Stack space is reserved, FP registers are stacked only if the handler uses the FPU (ASPEN = 1, LSPEN = 1).
+    };
+
+    //! Enable full access to the FPU (CP10 and CP11) and configure FP context preservation.
+    //! FPCCR is configured first so the selected policy is already in place when the first
+    //! floating-point instruction executes. The barriers guarantee the CPACR write has completed
+    //! before any following instruction is fetched.
+    //! \note Must be called from privileged code before any floating-point instruction.
+    [[gnu::always_inline]] static inline void enable(StatePreservation policy = StatePreservation::LAZY)
+    {
+        modify<FPCCR>(FPU->FPCCR, FPCCR::ASPEN_FIELD(policy != StatePreservation::NONE), FPCCR::LSPEN_FIELD(policy == StatePreservation::LAZY));
+        modify<Scb::CPACR>(SCB->CPACR, Scb::CPACR::CP10_FIELD(Scb::CPACR::Access::FULL), Scb::CPACR::CP11_FIELD(Scb::CPACR::Access::FULL));
+
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Floating-point arithmetic mode (RMode, FZ and DN fields of FPSCR and FPDSCR).
+    struct Mode {
+        FPSCR::RMode rounding = FPSCR::RMode::NEAREST; //!< Rounding mode.
+        bool flush_to_zero = false; //!< Flush denormal inputs and results to zero.
+        bool default_nan = false; //!< Return the default NaN instead of propagating NaN operands.
+
+        //! FPSCR/FPDSCR bits selected by this mode.
+        constexpr uint32_t toRegValue() const
+        {
+            return (static_cast<uint32_t>(rounding) << 22) |
+                (static_cast<uint32_t>(flush_to_zero) << 24) |
+                (static_cast<uint32_t>(default_nan) << 25);
+        }
+
+        //! Extract the mode from a FPSCR or FPDSCR value.
+        static constexpr Mode fromRegValue(uint32_t value)
+        {
+            return Mode {
+                static_cast<FPSCR::RMode>((value >> 22) & 0x3u),
+                ((value >> 24) & 0x1u) != 0,
+                ((value >> 25) & 0x1u) != 0
+            };
+        }
+    };
+
+    //! Mask of the RMode, FZ and DN fields in FPSCR and FPDSCR.
+    inline constexpr uint32_t MODE_MASK = 0x03C00000u;
+
+    //! Full IEEE 754 behaviour (reset default).
+    inline constexpr Mode IEEE_MODE {};
+
+    //! Flush-to-zero and default NaN, avoids the slow denormal paths in DSP code.
+    inline constexpr Mode FAST_MATH_MODE { FPSCR::RMode::NEAREST, true, true };
+
+    //! Get the arithmetic mode of the current floating-point context.
+    [[gnu::always_inline]] static inline Mode getMode()
+    {
+        return Mode::fromRegValue(getFpscrReg().value);
+    }
+
+    //! Set the arithmetic mode of the current floating-point context.
+    //! Cumulative exception flags and condition flags in FPSCR are preserved.
+    [[gnu::always_inline]] static inline void setMode(Mode mode)
+    {
+        FPSCR fpscr = getFpscrReg();
+        fpscr.value = (fpscr.value & ~MODE_MASK) | mode.toRegValue();
+        setFpscrReg(fpscr);
+    }
+
+    //! Get the arithmetic mode that new floating-point contexts start with.
+    [[gnu::always_inline]] static inline Mode getDefaultMode()
+    {
+        return Mode::fromRegValue(FPU->FPDSCR);
+    }
+
+    //! Set the arithmetic mode that new floating-point contexts start with.
+    //! With automatic state preservation enabled, every exception handler that uses the FPU
+    //! gets its FPSCR initialised from FPDSCR, independent of the mode of the interrupted code.
+    [[gnu::always_inline]] static inline void setDefaultMode(Mode mode)
+    {
+        FPDSCR fpdscr { FPU->FPDSCR };
+        fpdscr.value = (fpdscr.value & ~MODE_MASK) | mode.toRegValue();
+        FPU->FPDSCR = fpdscr.value;
+    }
+
+    //! Switches the current floating-point context to a mode for the lifetime of the object
+    //! and restores the previous RMode, FZ and DN settings on destruction.
+    //! \note The compiler does not model the dependency of arithmetic on FPSCR, so keep
+    //!       the computations of the scope in memory or in a separate, non-inlined function.
+    class ScopedMode {
+    public:
+        [[gnu::always_inline]] explicit ScopedMode(Mode mode) :
+            m_saved_mode_bits(getFpscrReg().value & MODE_MASK)
+        {
+            setMode(mode);
+        }
+
+        [[gnu::always_inline]] ~ScopedMode()
+        {
+            FPSCR fpscr = getFpscrReg();
+            fpscr.value = (fpscr.value & ~MODE_MASK) | m_saved_mode_bits;
+            setFpscrReg(fpscr);
+        }
+
+        ScopedMode(const ScopedMode&) = delete;
+        ScopedMode& operator=(const ScopedMode&) = delete;
+
+    private:
+        uint32_t m_saved_mode_bits;
+    };
+}
@@ -0,0 +1,280 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/intrinsics/exceptions.hpp"
+#include "armcortex/m4/dcb.hpp"
+#include "armcortex/m4/special_regs.hpp"
+#include "armcortex/register_field.hpp"
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace ArmCortex::Itm {
+    inline constexpr uintptr_t BASE_ADDRESS = 0xE0000000u;
+    inline constexpr uint16_t NUM_OF_PORTS = 256;
+    inline constexpr uint32_t LOCK_ACCESS_KEY = 0xC5ACCE55u; //!< Written to LAR to unlock the other registers.
+
+    //! Stimulus port, the access size selects the size of the emitted packet.
+    union StimulusPort {
+        volatile uint8_t U8; //!< 8-bit write.
+        volatile uint16_t U16; //!< 16-bit write.
+        volatile uint32_t U32; //!< 32-bit write, reads bit 0 as FIFOREADY.
+    };
+
+    struct Registers {
+        StimulusPort STIM[NUM_OF_PORTS]; //!< Stimulus port registers.
+        volatile uint32_t RESERVED0[640];
+        volatile uint32_t TER[8]; //!< Trace enable registers, one bit per stimulus port.
+        volatile uint32_t RESERVED1[8];
+        volatile uint32_t TPR; //!< Trace privilege register, one bit per group of 8 ports.
+        volatile uint32_t RESERVED2[15];
+        volatile uint32_t TCR; //!< Trace control register.
+        volatile uint32_t RESERVED3[75];
+        volatile uint32_t LAR; //!< Lock access register.
+        volatile uint32_t LSR; //!< Lock status register.
+    };
+
+    //! Trace control register.
+    union TCR {
+        //! Local timestamp prescaler applied to the processor clock.
+        enum class TimestampPrescaler : uint8_t {
+            DIV_1 = 0b00, //!< No prescaling.
+            DIV_4 = 0b01, //!< Divide by 4.
+            DIV_16 = 0b10, //!< Divide by 16.
+            DIV_64 = 0b11 //!< Divide by 64.
+        };
+
+        struct Bits {
+            uint32_t ITMENA: 1; //!< Global ITM enable.
+            uint32_t TSENA: 1; //!< Local timestamp packets enable.
+            uint32_t SYNCENA: 1; //!< Synchronisation packets enable (also needs DWT_CTRL.SYNCTAP).
+            uint32_t TXENA: 1; //!< Forward DWT packets to the ITM.
+            uint32_t SWOENA: 1; //!< Count local timestamps on the SWO clock instead of the processor clock.
+            uint32_t RESERVED0: 3;
+            uint32_t TSPRESCALE: 2; //!< Local timestamp prescaler.
+            uint32_t GTSFREQ: 2; //!< Global timestamp frequency.
+            uint32_t RESERVED1: 4;
+            uint32_t TRACEBUSID: 7; //!< ATB ID of the ITM, must be non-zero and unique in the system.
+            uint32_t BUSY: 1; //!< ITM is processing packets.
+            uint32_t RESERVED2: 8;
+        } bits;
+
+        static constexpr Field<TCR, 0, 1> ITMENA_FIELD {};
+        static constexpr Field<TCR, 1, 1> TSENA_FIELD {};
+        static constexpr Field<TCR, 2, 1> SYNCENA_FIELD {};
+        static constexpr Field<TCR, 3, 1> TXENA_FIELD {};
+        static constexpr Field<TCR, 4, 1> SWOENA_FIELD {};
+        static constexpr Field<TCR, 8, 2> TSPRESCALE_FIELD {};
+        static constexpr Field<TCR, 10, 2> GTSFREQ_FIELD {};
+        static constexpr Field<TCR, 16, 7> TRACEBUSID_FIELD {};
+        static constexpr Field<TCR, 23, 1, FieldAccess::RO> BUSY_FIELD {};
+
+        uint32_t value = 0;
+
+        TCR() = default;
+
+        TCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+}
+
+namespace ArmCortex {
+    inline volatile Itm::Registers* const ITM = reinterpret_cast<volatile Itm::Registers*>(Itm::BASE_ADDRESS);
+}
+
+namespace ArmCortex::Itm {
+    //! Enable trace and the ITM with synchronisation packets, and enable the stimulus ports 0-31 in port_mask.
+    //! \note The trace output (TPIU and SWO pin) is set up by the debug probe or by the device specific code.
+    //! \param port_mask Bit mask of the enabled stimulus ports 0-31.
+    //! \param trace_bus_id ATB ID of the ITM (1-127).
+    [[gnu::always_inline]] static inline void enable(uint32_t port_mask = 0x00000001u, uint8_t trace_bus_id = 1)
+    {
+        Dcb::enableTrace();
+        ITM->LAR = LOCK_ACCESS_KEY;
+        write<TCR>(ITM->TCR, TCR::ITMENA_FIELD(1), TCR::SYNCENA_FIELD(1), TCR::TXENA_FIELD(1), TCR::TRACEBUSID_FIELD(trace_bus_id));
+        ITM->TER[0] = port_mask;
+    }
+
+    //! Check if the ITM and the stimulus port are enabled, i.e. whether writes to the port are traced.
+    [[gnu::always_inline]] static inline bool isPortEnabled(uint8_t port)
+    {
+        return (read<TCR>(ITM->TCR, TCR::ITMENA_FIELD) != 0) && ((ITM->TER[port / 32] & (1u << (port % 32))) != 0);
+    }
+
+    //! Check if the stimulus port FIFO can accept a write.
+    //! \note Reads as not ready while the ITM is disabled.
+    [[gnu::always_inline]] static inline bool isReady(uint8_t port)
+    {
+        return (ITM->STIM[port].U32 & 1u) != 0;
+    }
+
+    //! Write a value to a stimulus port, waiting while its FIFO is full.
+    //! Returns immediately without writing if the port is not enabled, so it never blocks without a trace probe.
+    //! \tparam T uint8_t, uint16_t or uint32_t, selects the packet size.
+    template<typename T>
+    [[gnu::always_inline]] static inline void write(uint8_t port, T value)
+    {
+        static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t>,
+            "Stimulus port writes are 8, 16 or 32 bits wide.");
+
+        if (!isPortEnabled(port)) {
+            return;
+        }
+
+        while (!isReady(port)) {
+        }
+
+        if constexpr (std::is_same_v<T, uint8_t>) {
+            ITM->STIM[port].U8 = value;
+        } else if constexpr (std::is_same_v<T, uint16_t>) {
+            ITM->STIM[port].U16 = value;
+        } else {
+            ITM->STIM[port].U32 = value;
+        }
+    }
+
+    //! Write a value to a stimulus port only if its FIFO can accept it, otherwise drop it.
+    //! \tparam T uint8_t, uint16_t or uint32_t, selects the packet size.
+    //! \return True if the value was written.
+    template<typename T>
+    [[gnu::always_inline]] static inline bool tryWrite(uint8_t port, T value)
+    {
+        static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t>,
+            "Stimulus port writes are 8, 16 or 32 bits wide.");
+
+        if (!isReady(port)) {
+            return false;
+        }
+
+        if constexpr (std::is_same_v<T, uint8_t>) {
+            ITM->STIM[port].U8 = value;
+        } else if constexpr (std::is_same_v<T, uint16_t>) {
+            ITM->STIM[port].U16 = value;
+        } else {
+            ITM->STIM[port].U32 = value;
+        }
+
+        return true;
+    }
+
+    //! Format string literal usable as a template argument of log().
+    template<uint32_t size>
+    struct FormatString {
+        char text[size];
+
+        consteval FormatString(const char (&literal)[size])
+        {
+            for (uint32_t i = 0; i < size; i++) {
+                text[i] = literal[i];
+            }
+        }
+    };
+
+    //! Format string kept in the .itm_formats ELF section, which is not loaded to the target.
+    //! Clang honours the section attribute, GCC ignores it for template members and emits a
+    //! .rodata.<mangled name> section instead, so the linker script collects both, before .rodata:
+    //! \code
+    //! .itm_formats 0 (INFO) : { KEEP(*(.itm_formats)) KEEP(*(.rodata._ZN8ArmCortex3Itm11FormatEntry*)) }
+    //! \endcode
+    //! The address of a string is then its offset in the section, which the host decoder looks up.
+    template<FormatString format>
+    struct FormatEntry {
+        [[gnu::section(".itm_formats"), gnu::used]] static constexpr FormatString TEXT = format;
+    };
+
+    inline constexpr uint32_t MAX_NUM_OF_LOG_ARGS = 15;
+    inline constexpr uint32_t LOG_ID_MASK = 0x00FFFFFFu; //!< Format string offset bits of the message header.
+
+    //! Stimulus ports whose last non-blocking log() message was cut short, one bit per port.
+    //! The next message on such a port starts with a one-byte resync packet for the host decoder.
+    inline uint32_t truncated_log_ports[NUM_OF_PORTS / 32] = {};
+
+    //! Argument of a tokenised message as a 32-bit word.
+    template<typename T>
+    constexpr uint32_t toLogWord(T arg)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return std::bit_cast<uint32_t>(arg);
+        } else if constexpr (std::is_pointer_v<T>) {
+            return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(arg));
+        } else {
+            static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Log arguments are integers, enums, floats or pointers.");
+            return static_cast<uint32_t>(arg);
+        }
+    }
+
+    //! Tokenised log message, only a format ID and the raw arguments are sent.
+    //! The message is a header word (argument count in bits [31:24], format string offset in bits [23:0])
+    //! followed by one word per argument, all written with interrupts disabled so messages from
+    //! different priority levels do not interleave. tools/itm_decode.py formats them on the host.
+    //! \code
+    //! ArmCortex::Itm::log<"adc=%u temp=%f">(1, raw, celsius);
+    //! \endcode
+    //! \tparam format printf-style format string with one 32-bit conversion (%d, %u, %x, %c or %f) per argument.
+    //! \tparam blocking If false, every word is written only if the port FIFO has room, so interrupts stay masked
+    //!         for at most one FIFOREADY poll per word. The rest of the message is dropped at the first full FIFO,
+    //!         and the next message on the port is preceded by a one-byte resync packet.
+    //! \return True if the whole message was written.
+    template<FormatString format, bool blocking = true, typename... Args>
+    [[gnu::always_inline]] static inline bool log(uint8_t port, Args... args)
+    {
+        static_assert(sizeof...(Args) <= MAX_NUM_OF_LOG_ARGS, "Too many log arguments.");
+
+        if (!isPortEnabled(port)) {
+            return false;
+        }
+
+        uint32_t header = (uint32_t{sizeof...(Args)} << 24) |
+            (static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&FormatEntry<format>::TEXT)) & LOG_ID_MASK);
+
+        uint32_t& truncated = truncated_log_ports[port / 32];
+        const uint32_t port_bit = uint32_t{1} << (port % 32);
+        bool written;
+
+        PRIMASK primask = getPrimaskReg();
+        asmCpsid();
+
+        if constexpr (blocking) {
+            if ((truncated & port_bit) != 0) {
+                write(port, uint8_t{0});
+                truncated &= ~port_bit;
+            }
+
+            write(port, header);
+            (write(port, toLogWord(args)), ...);
+            written = true;
+        } else {
+            if (((truncated & port_bit) != 0) && tryWrite(port, uint8_t{0})) {
+                truncated &= ~port_bit;
+            }
+
+            written = ((truncated & port_bit) == 0) && tryWrite(port, header);
+
+            if (written && !(tryWrite(port, toLogWord(args)) && ...)) {
+                truncated |= port_bit;
+                written = false;
+            }
+        }
+
+        setPrimaskReg(primask);
+        return written;
+    }
+}
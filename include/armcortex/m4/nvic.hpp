@@ -17,6 +17,7 @@
 #pragma once
 
 #include "armcortex/bit_utils.hpp"
+#include "armcortex/m4/scnscb.hpp"
 #include <cstdint>
 
 namespace ArmCortex::Nvic {
@@ -83,4 +84,31 @@ namespace ArmCortex::Nvic {
     {
         return ArmCortex::isBitSet(NVIC->IABR[irq_number / 32], irq_number % 32);
     }
+
+    //! Number of ISER/ICER/ISPR/ICPR/IABR words backing the implemented interrupt lines, from ICTR.
+    //! Bulk operations loop over these instead of all 8 words.
+    [[gnu::always_inline]] static inline uint32_t getNumOfIrqWords()
+    {
+        return ScnScb::getNumOfIrqLines() / 32;
+    }
+
+    //! Disable all implemented interrupts.
+    [[gnu::always_inline]] static inline void disableAllIrqs()
+    {
+        uint32_t num_of_words = getNumOfIrqWords();
+
+        for (uint32_t word = 0; word < num_of_words; word++) {
+            NVIC->ICER[word] = 0xFFFFFFFFu;
+        }
+    }
+
+    //! Clear the pending state of all implemented interrupts.
+    [[gnu::always_inline]] static inline void clearAllPendingIrqs()
+    {
+        uint32_t num_of_words = getNumOfIrqWords();
+
+        for (uint32_t word = 0; word < num_of_words; word++) {
+            NVIC->ICPR[word] = 0xFFFFFFFFu;
+        }
+    }
 }
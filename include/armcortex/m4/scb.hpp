@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/register_field.hpp"
 #include <cstdint>
 
 namespace ArmCortex::Scb {
@@ -58,6 +60,12 @@ namespace ArmCortex::Scb {
             uint32_t IMPLEMENTER: 8; //!< Implementer code (0x41: ARM).
         } bits;
 
+        static constexpr Field<CPUID, 0, 4, FieldAccess::RO> REVISION_FIELD {};
+        static constexpr Field<CPUID, 4, 12, FieldAccess::RO> PARTNO_FIELD {};
+        static constexpr Field<CPUID, 16, 4, FieldAccess::RO> ARCHITECTURE_FIELD {};
+        static constexpr Field<CPUID, 20, 4, FieldAccess::RO> VARIANT_FIELD {};
+        static constexpr Field<CPUID, 24, 8, FieldAccess::RO> IMPLEMENTER_FIELD {};
+
         uint32_t value = 0;
 
         CPUID() = default;
@@ -91,6 +99,19 @@ namespace ArmCortex::Scb {
             uint32_t NMIPENDSET: 1; //!< NMI pending (read), write 1 to set pending.
         } bits;
 
+        static constexpr uint32_t WRITE_ONE_MASK = 0x9E000000u; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<ICSR, 0, 9, FieldAccess::RO> VECTACTIVE_FIELD {};
+        static constexpr Field<ICSR, 11, 1, FieldAccess::RO> RETTOBASE_FIELD {};
+        static constexpr Field<ICSR, 12, 9, FieldAccess::RO> VECTPENDING_FIELD {};
+        static constexpr Field<ICSR, 22, 1, FieldAccess::RO> ISRPENDING_FIELD {};
+        static constexpr Field<ICSR, 23, 1, FieldAccess::RO> ISRPREEMPT_FIELD {};
+        static constexpr Field<ICSR, 25, 1, FieldAccess::W1C> PENDSTCLR_FIELD {};
+        static constexpr Field<ICSR, 26, 1, FieldAccess::W1S> PENDSTSET_FIELD {};
+        static constexpr Field<ICSR, 27, 1, FieldAccess::W1C> PENDSVCLR_FIELD {};
+        static constexpr Field<ICSR, 28, 1, FieldAccess::W1S> PENDSVSET_FIELD {};
+        static constexpr Field<ICSR, 31, 1, FieldAccess::W1S> NMIPENDSET_FIELD {};
+
         uint32_t value = 0;
 
         ICSR() = default;
@@ -117,6 +138,15 @@ namespace ArmCortex::Scb {
             uint32_t VECTKEY: 16; //!< Write VECTKEY_VALUE to enable writes, otherwise ignored.
         } bits;
 
+        static constexpr uint32_t WRITE_KEY = uint32_t{VECTKEY_VALUE} << 16; //!< Inserted by modify() and write().
+        static constexpr uint32_t WRITE_KEY_MASK = 0xFFFF0000u;
+
+        static constexpr Field<AIRCR, 0, 1> VECTRESET_FIELD {};
+        static constexpr Field<AIRCR, 1, 1> VECTCLRACTIVE_FIELD {};
+        static constexpr Field<AIRCR, 2, 1> SYSRESETREQ_FIELD {};
+        static constexpr Field<AIRCR, 8, 3> PRIGROUP_FIELD {};
+        static constexpr Field<AIRCR, 15, 1, FieldAccess::RO> ENDIANNESS_FIELD {};
+
         uint32_t value = 0;
 
         AIRCR() = default;
@@ -138,6 +168,10 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED2: 27;
         } bits;
 
+        static constexpr Field<SCR, 1, 1> SLEEPONEXIT_FIELD {};
+        static constexpr Field<SCR, 2, 1> SLEEPDEEP_FIELD {};
+        static constexpr Field<SCR, 4, 1> SEVONPEND_FIELD {};
+
         uint32_t value = 0;
 
         SCR() = default;
@@ -162,6 +196,13 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED2: 22;
         } bits;
 
+        static constexpr Field<CCR, 0, 1> NONBASETHRDENA_FIELD {};
+        static constexpr Field<CCR, 1, 1> USERSETMPEND_FIELD {};
+        static constexpr Field<CCR, 3, 1> UNALIGN_TRP_FIELD {};
+        static constexpr Field<CCR, 4, 1> DIV_0_TRP_FIELD {};
+        static constexpr Field<CCR, 8, 1> BFHFNMIGN_FIELD {};
+        static constexpr Field<CCR, 9, 1> STKALIGN_FIELD {};
+
         uint32_t value = 0;
 
         CCR() = default;
@@ -195,6 +236,21 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED3: 13;
         } bits;
 
+        static constexpr Field<SHCSR, 0, 1> MEMFAULTACT_FIELD {};
+        static constexpr Field<SHCSR, 1, 1> BUSFAULTACT_FIELD {};
+        static constexpr Field<SHCSR, 3, 1> USGFAULTACT_FIELD {};
+        static constexpr Field<SHCSR, 7, 1> SVCALLACT_FIELD {};
+        static constexpr Field<SHCSR, 8, 1> MONITORACT_FIELD {};
+        static constexpr Field<SHCSR, 10, 1> PENDSVACT_FIELD {};
+        static constexpr Field<SHCSR, 11, 1> SYSTICKACT_FIELD {};
+        static constexpr Field<SHCSR, 12, 1> USGFAULTPENDED_FIELD {};
+        static constexpr Field<SHCSR, 13, 1> MEMFAULTPENDED_FIELD {};
+        static constexpr Field<SHCSR, 14, 1> BUSFAULTPENDED_FIELD {};
+        static constexpr Field<SHCSR, 15, 1> SVCALLPENDED_FIELD {};
+        static constexpr Field<SHCSR, 16, 1> MEMFAULTENA_FIELD {};
+        static constexpr Field<SHCSR, 17, 1> BUSFAULTENA_FIELD {};
+        static constexpr Field<SHCSR, 18, 1> USGFAULTENA_FIELD {};
+
         uint32_t value = 0;
 
         SHCSR() = default;
@@ -241,6 +297,28 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED4: 6;
         } bits;
 
+        static constexpr uint32_t WRITE_ONE_MASK = 0x030FBFBBu; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<CFSR, 0, 1, FieldAccess::W1C> IACCVIOL_FIELD {};
+        static constexpr Field<CFSR, 1, 1, FieldAccess::W1C> DACCVIOL_FIELD {};
+        static constexpr Field<CFSR, 3, 1, FieldAccess::W1C> MUNSTKERR_FIELD {};
+        static constexpr Field<CFSR, 4, 1, FieldAccess::W1C> MSTKERR_FIELD {};
+        static constexpr Field<CFSR, 5, 1, FieldAccess::W1C> MLSPERR_FIELD {};
+        static constexpr Field<CFSR, 7, 1, FieldAccess::W1C> MMARVALID_FIELD {};
+        static constexpr Field<CFSR, 8, 1, FieldAccess::W1C> IBUSERR_FIELD {};
+        static constexpr Field<CFSR, 9, 1, FieldAccess::W1C> PRECISERR_FIELD {};
+        static constexpr Field<CFSR, 10, 1, FieldAccess::W1C> IMPRECISERR_FIELD {};
+        static constexpr Field<CFSR, 11, 1, FieldAccess::W1C> UNSTKERR_FIELD {};
+        static constexpr Field<CFSR, 12, 1, FieldAccess::W1C> STKERR_FIELD {};
+        static constexpr Field<CFSR, 13, 1, FieldAccess::W1C> LSPERR_FIELD {};
+        static constexpr Field<CFSR, 15, 1, FieldAccess::W1C> BFARVALID_FIELD {};
+        static constexpr Field<CFSR, 16, 1, FieldAccess::W1C> UNDEFINSTR_FIELD {};
+        static constexpr Field<CFSR, 17, 1, FieldAccess::W1C> INVSTATE_FIELD {};
+        static constexpr Field<CFSR, 18, 1, FieldAccess::W1C> INVPC_FIELD {};
+        static constexpr Field<CFSR, 19, 1, FieldAccess::W1C> NOCP_FIELD {};
+        static constexpr Field<CFSR, 24, 1, FieldAccess::W1C> UNALIGNED_FIELD {};
+        static constexpr Field<CFSR, 25, 1, FieldAccess::W1C> DIVBYZERO_FIELD {};
+
         uint32_t value = 0;
 
         CFSR() = default;
@@ -262,6 +340,12 @@ namespace ArmCortex::Scb {
             uint32_t DEBUGEVT: 1; //!< Debug event HardFault.
         } bits;
 
+        static constexpr uint32_t WRITE_ONE_MASK = 0xC0000002u; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<HFSR, 1, 1, FieldAccess::W1C> VECTTBL_FIELD {};
+        static constexpr Field<HFSR, 30, 1, FieldAccess::W1C> FORCED_FIELD {};
+        static constexpr Field<HFSR, 31, 1, FieldAccess::W1C> DEBUGEVT_FIELD {};
+
         uint32_t value = 0;
 
         HFSR() = default;
@@ -284,6 +368,14 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED: 27;
         } bits;
 
+        static constexpr uint32_t WRITE_ONE_MASK = 0x0000001Fu; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<DFSR, 0, 1, FieldAccess::W1C> HALTED_FIELD {};
+        static constexpr Field<DFSR, 1, 1, FieldAccess::W1C> BKPT_FIELD {};
+        static constexpr Field<DFSR, 2, 1, FieldAccess::W1C> DWTTRAP_FIELD {};
+        static constexpr Field<DFSR, 3, 1, FieldAccess::W1C> VCATCH_FIELD {};
+        static constexpr Field<DFSR, 4, 1, FieldAccess::W1C> EXTERNAL_FIELD {};
+
         uint32_t value = 0;
 
         DFSR() = default;
@@ -318,9 +410,20 @@ namespace ArmCortex::Scb {
             uint32_t RESERVED0: 4;
             uint32_t CP10: 2; //!< Coprocessor 10 access (FPU).
             uint32_t CP11: 2; //!< Coprocessor 11 access (FPU).
-            uint32_t RESERVED1: 4;
+            uint32_t RESERVED1: 8;
         } bits;
 
+        static constexpr Field<CPACR, 0, 2> CP0_FIELD {};
+        static constexpr Field<CPACR, 2, 2> CP1_FIELD {};
+        static constexpr Field<CPACR, 4, 2> CP2_FIELD {};
+        static constexpr Field<CPACR, 6, 2> CP3_FIELD {};
+        static constexpr Field<CPACR, 8, 2> CP4_FIELD {};
+        static constexpr Field<CPACR, 10, 2> CP5_FIELD {};
+        static constexpr Field<CPACR, 12, 2> CP6_FIELD {};
+        static constexpr Field<CPACR, 14, 2> CP7_FIELD {};
+        static constexpr Field<CPACR, 20, 2> CP10_FIELD {};
+        static constexpr Field<CPACR, 22, 2> CP11_FIELD {};
+
         uint32_t value = 0;
 
         CPACR() = default;
@@ -339,7 +442,7 @@ namespace ArmCortex {
 namespace ArmCortex::Scb {
     [[gnu::noreturn, gnu::always_inline]] static inline void systemReset()
     {
-        asm volatile("dsb sy" ::: "memory");
+        asmDsb();
 
         AIRCR aircr { SCB->AIRCR };
 
@@ -350,15 +453,15 @@ namespace ArmCortex::Scb {
 
         SCB->AIRCR = aircr.value;
 
-        asm volatile("dsb sy" ::: "memory");
-        asm volatile("isb sy" ::: "memory");
+        asmDsb();
+        asmIsb();
 
         while(true);
     }
 
     [[gnu::always_inline]] static inline void setPriorityGrouping(uint32_t priority_group)
     {
-        asm volatile("dsb sy" ::: "memory");
+        asmDsb();
 
         AIRCR aircr { SCB->AIRCR };
 
@@ -367,8 +470,8 @@ namespace ArmCortex::Scb {
 
         SCB->AIRCR = aircr.value;
 
-        asm volatile("dsb sy" ::: "memory");
-        asm volatile("isb sy" ::: "memory");
+        asmDsb();
+        asmIsb();
     }
 
     [[gnu::always_inline]] static inline uint32_t getPriorityGrouping()
@@ -317,6 +317,59 @@ namespace ArmCortex {
         asm volatile("MSR CONTROL, %0" : : "r" (control.value) : "cc", "memory");
     }
 
+    //! Switch thread mode from MSP to PSP, keeping the current stack contents, and give exceptions a stack of their own.
+    //! Copies MSP into PSP, sets CONTROL.SPSEL, executes an ISB and then moves MSP to main_stack_top, as a
+    //! single sequence the compiler cannot reorder or split. Thread code keeps growing its stack down from
+    //! the current address, exceptions are stacked from main_stack_top.
+    //! \param main_stack_top Initial main stack pointer for handlers (8-byte aligned end of a stack area that
+    //!        does not overlap the current stack, which belongs to thread mode from now on).
+    //! \note Call from privileged thread mode only, handler mode always uses MSP.
+    [[gnu::always_inline]] static inline void switchToPsp(uint32_t main_stack_top)
+    {
+        uint32_t stack_pointer;
+        uint32_t spsel_bit;
+
+        asm volatile(
+            "MRS %0, MSP\n\t"
+            "MSR PSP, %0\n\t"
+            "MRS %0, CONTROL\n\t"
+            "MOVS %1, #2\n\t"
+            "ORRS %0, %1\n\t"
+            "MSR CONTROL, %0\n\t"
+            "ISB\n\t"
+            "MSR MSP, %2"
+            : "=&l" (stack_pointer), "=&l" (spsel_bit) : "l" (main_stack_top) : "cc", "memory"
+        );
+    }
+
+    //! Start executing entry in unprivileged thread mode on a new process stack.
+    //! Sets PSP to stack_top, then sets CONTROL.SPSEL and CONTROL.nPRIV and executes an ISB before
+    //! branching, so entry is the first code to run with the new privilege level and stack.
+    //! Privileged execution can only be regained through an exception (e.g. SVC).
+    //! \param stack_top Initial process stack pointer (8-byte aligned end of the stack area).
+    //! \param entry Function to run unprivileged. If it returns, execution stops in an endless loop.
+    //! \note Call from privileged thread mode.
+    [[gnu::noreturn, gnu::always_inline]] static inline void enterUnprivilegedThread(uint32_t stack_top, void (*entry)())
+    {
+        uint32_t control;
+        uint32_t control_bits;
+
+        asm volatile(
+            "MSR PSP, %2\n\t"
+            "MRS %0, CONTROL\n\t"
+            "MOVS %1, #3\n\t"
+            "ORRS %0, %1\n\t"
+            "MSR CONTROL, %0\n\t"
+            "ISB\n\t"
+            "BLX %3\n"
+            "1:\n\t"
+            "B 1b"
+            : "=&l" (control), "=&l" (control_bits) : "l" (stack_top), "l" (entry) : "cc", "memory"
+        );
+
+        __builtin_unreachable();
+    }
+
     [[gnu::always_inline]] static inline FPSCR getFpscrReg()
     {
         FPSCR fpscr;
@@ -326,6 +379,6 @@ namespace ArmCortex {
 
     [[gnu::always_inline]] static inline void setFpscrReg(FPSCR fpscr)
     {
-        asm volatile("VMSR FPSCR, %0" : : "r" (fpscr.value) : "cc");
+        asm volatile("VMSR FPSCR, %0" : : "r" (fpscr.value) : "cc", "memory");
     }
 }
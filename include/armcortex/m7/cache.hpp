@@ -0,0 +1,280 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/bit_utils.hpp"
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/m7/scb.hpp"
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::Cache {
+    //! Cache line size of both Cortex-M7 L1 caches in bytes.
+    //! Buffers shared with a DMA controller need maintenance while the data cache is enabled: clean them
+    //! before the DMA reads them, invalidate them before the CPU reads what the DMA wrote. Declare them
+    //! alignas(LINE_SIZE) with a size of roundUpToLine(), so no other data shares their cache lines.
+    inline constexpr uint32_t LINE_SIZE = 32;
+
+    //! Round a buffer size up to a whole number of cache lines.
+    [[gnu::always_inline]] constexpr uint32_t roundUpToLine(uint32_t size)
+    {
+        return (size + LINE_SIZE - 1) & ~(LINE_SIZE - 1);
+    }
+
+    //! Check if an address is aligned to a cache line.
+    [[gnu::always_inline]] constexpr bool isLineAligned(uintptr_t address)
+    {
+        return (address & (LINE_SIZE - 1)) == 0;
+    }
+
+    //! Geometry of an L1 cache.
+    struct Geometry {
+        uint32_t sets; //!< Number of sets.
+        uint32_t ways; //!< Number of ways.
+        uint32_t line_size; //!< Line size in bytes.
+    };
+
+    //! Read the geometry of the L1 instruction or data cache from CCSIDR.
+    [[gnu::always_inline]] static inline Geometry getGeometry(bool instruction_cache)
+    {
+        write<Scb::CSSELR>(SCB->CSSELR, Scb::CSSELR::IND_FIELD(instruction_cache), Scb::CSSELR::LEVEL_FIELD(0));
+        asmDsb();
+
+        Scb::CCSIDR ccsidr { SCB->CCSIDR };
+
+        return Geometry {
+            .sets = ccsidr.bits.NUMSETS + 1u,
+            .ways = ccsidr.bits.ASSOCIATIVITY + 1u,
+            .line_size = 16u << ccsidr.bits.LINESIZE
+        };
+    }
+
+    //! Write every set/way of the L1 data cache to a set/way maintenance register (DCISW, DCCSW or DCCISW).
+    //! \note Not synchronised, callers add the barriers.
+    [[gnu::always_inline]] static inline void forEachDCacheSetWay(volatile uint32_t& operation)
+    {
+        SCB->CSSELR = 0; // L1 data cache.
+        asmDsb();
+
+        Scb::CCSIDR ccsidr { SCB->CCSIDR };
+
+        const uint32_t set_shift = ccsidr.bits.LINESIZE + 4u;
+        const uint32_t max_way = ccsidr.bits.ASSOCIATIVITY;
+        const uint32_t way_shift = (max_way != 0) ? countLeadingZeros(max_way) : 0;
+
+        for (uint32_t set = ccsidr.bits.NUMSETS + 1u; set-- > 0;) {
+            for (uint32_t way = max_way + 1u; way-- > 0;) {
+                operation = (set << set_shift) | (way << way_shift);
+            }
+        }
+    }
+
+    //! Write every cache line of an address range to a by-address maintenance register.
+    //! The range is extended to whole lines.
+    //! \note Not synchronised, callers add the barriers.
+    [[gnu::always_inline]] static inline void forEachLine(volatile uint32_t& operation, uintptr_t address, uint32_t size)
+    {
+        const uintptr_t end = address + size;
+
+        for (uintptr_t line = address & ~uintptr_t{LINE_SIZE - 1}; line < end; line += LINE_SIZE) {
+            operation = line;
+        }
+    }
+
+    // =========================================================================
+    // Instruction cache
+    // =========================================================================
+
+    //! Check if the L1 instruction cache is enabled.
+    [[gnu::always_inline]] static inline bool isICacheEnabled()
+    {
+        return read<Scb::CCR>(SCB->CCR, Scb::CCR::IC_FIELD) != 0;
+    }
+
+    //! Invalidate the whole L1 instruction cache.
+    //! Required after code in memory was changed (e.g. copied to RAM or flash reprogrammed).
+    [[gnu::always_inline]] static inline void invalidateICache()
+    {
+        asmDsb();
+        asmIsb();
+        SCB->ICIALLU = 0;
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Invalidate the L1 instruction cache lines covering an address range.
+    //! \note When the code was written by the CPU, clean it from the data cache first, see cleanDCacheRange().
+    [[gnu::always_inline]] static inline void invalidateICacheRange(const volatile void* address, uint32_t size)
+    {
+        asmDsb();
+        forEachLine(SCB->ICIMVAU, reinterpret_cast<uintptr_t>(address), size);
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Invalidate and enable the L1 instruction cache, nothing is done if it is already enabled.
+    [[gnu::always_inline]] static inline void enableICache()
+    {
+        if (isICacheEnabled()) {
+            return;
+        }
+
+        invalidateICache();
+        modify<Scb::CCR>(SCB->CCR, Scb::CCR::IC_FIELD(1));
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Disable and invalidate the L1 instruction cache.
+    [[gnu::always_inline]] static inline void disableICache()
+    {
+        asmDsb();
+        asmIsb();
+        modify<Scb::CCR>(SCB->CCR, Scb::CCR::IC_FIELD(0));
+        SCB->ICIALLU = 0;
+        asmDsb();
+        asmIsb();
+    }
+
+    // =========================================================================
+    // Data cache
+    // =========================================================================
+
+    //! Check if the L1 data cache is enabled.
+    [[gnu::always_inline]] static inline bool isDCacheEnabled()
+    {
+        return read<Scb::CCR>(SCB->CCR, Scb::CCR::DC_FIELD) != 0;
+    }
+
+    //! Invalidate the whole L1 data cache, discarding all dirty lines.
+    //! \warning Only safe while the data cache is disabled, otherwise use cleanInvalidateDCache().
+    [[gnu::always_inline]] static inline void invalidateDCache()
+    {
+        forEachDCacheSetWay(SCB->DCISW);
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Write all dirty lines of the L1 data cache back to memory.
+    [[gnu::always_inline]] static inline void cleanDCache()
+    {
+        forEachDCacheSetWay(SCB->DCCSW);
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Write all dirty lines of the L1 data cache back to memory and invalidate the whole cache.
+    [[gnu::always_inline]] static inline void cleanInvalidateDCache()
+    {
+        forEachDCacheSetWay(SCB->DCCISW);
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Invalidate and enable the L1 data cache, nothing is done if it is already enabled.
+    //! The cache content is undefined after reset, so it is invalidated before being enabled.
+    [[gnu::always_inline]] static inline void enableDCache()
+    {
+        if (isDCacheEnabled()) {
+            return;
+        }
+
+        forEachDCacheSetWay(SCB->DCISW);
+        asmDsb();
+        modify<Scb::CCR>(SCB->CCR, Scb::CCR::DC_FIELD(1));
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Disable the L1 data cache, then write its dirty lines back to memory and invalidate it.
+    [[gnu::always_inline]] static inline void disableDCache()
+    {
+        asmDsb();
+        modify<Scb::CCR>(SCB->CCR, Scb::CCR::DC_FIELD(0));
+        asmDsb();
+        forEachDCacheSetWay(SCB->DCCISW);
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Force write-through for all cacheable memory (CACR.FORCEWT).
+    //! Memory then always matches the data cache, so buffers read by a DMA controller need no cleaning,
+    //! at the cost of every store going out on the AXI bus.
+    [[gnu::always_inline]] static inline void setForceWriteThrough(bool enable)
+    {
+        asmDsb();
+        modify<Scb::CACR>(SCB->CACR, Scb::CACR::FORCEWT_FIELD(enable));
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Write the dirty L1 data cache lines covering an address range back to memory.
+    //! Use before a DMA controller reads a buffer the CPU wrote.
+    [[gnu::always_inline]] static inline void cleanDCacheRange(const volatile void* address, uint32_t size)
+    {
+        asmDsb();
+        forEachLine(SCB->DCCMVAC, reinterpret_cast<uintptr_t>(address), size);
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Write back and invalidate the L1 data cache lines covering an address range.
+    [[gnu::always_inline]] static inline void cleanInvalidateDCacheRange(const volatile void* address, uint32_t size)
+    {
+        asmDsb();
+        forEachLine(SCB->DCCIMVAC, reinterpret_cast<uintptr_t>(address), size);
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Invalidate the L1 data cache lines covering an address range, so the next reads fetch from memory.
+    //! Use after a DMA controller wrote a buffer and before the CPU reads it.
+    //! Lines only partially covered by the range are cleaned and invalidated instead, so data of
+    //! neighbouring variables in them is not lost.
+    //! \warning Writing back a partial line also overwrites the buffer bytes in it with their cached
+    //!          copy, align the buffer to LINE_SIZE and size it with roundUpToLine() to avoid that.
+    [[gnu::always_inline]] static inline void invalidateDCacheRange(volatile void* address, uint32_t size)
+    {
+        if (size == 0) {
+            return;
+        }
+
+        uintptr_t start = reinterpret_cast<uintptr_t>(address);
+        uintptr_t end = start + size;
+
+        asmDsb();
+
+        if (!isLineAligned(start)) {
+            start &= ~uintptr_t{LINE_SIZE - 1};
+            SCB->DCCIMVAC = start;
+            start += LINE_SIZE;
+        }
+
+        if (!isLineAligned(end) && (end > start)) {
+            end &= ~uintptr_t{LINE_SIZE - 1};
+            SCB->DCCIMVAC = end;
+        }
+
+        for (; start < end; start += LINE_SIZE) {
+            SCB->DCIMVAC = start;
+        }
+
+        asmDsb();
+        asmIsb();
+    }
+}
@@ -0,0 +1,899 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::Scb {
+    inline constexpr uintptr_t BASE_ADDRESS = 0xE000ED00u;
+
+    struct Registers
+    {
+        volatile uint32_t CPUID; //!< Processor part number, version, and implementation information.
+        volatile uint32_t ICSR; //!< Interrupt control and state register.
+        volatile uint32_t VTOR; //!< Vector table offset register.
+        volatile uint32_t AIRCR; //!< Application interrupt and reset control register.
+        volatile uint32_t SCR; //!< Low power state control.
+        volatile uint32_t CCR; //!< Configuration and control register.
+        volatile uint8_t SHPR[12]; //!< System handler priority registers.
+        volatile uint32_t SHCSR; //!< System handler control and state register.
+        volatile uint32_t CFSR; //!< Configurable fault status register.
+        volatile uint32_t HFSR; //!< HardFault status register.
+        volatile uint32_t DFSR; //!< Debug fault status register.
+        volatile uint32_t MMFAR; //!< MemManage fault address register.
+        volatile uint32_t BFAR; //!< BusFault address register.
+        volatile uint32_t AFSR; //!< Auxiliary fault status register.
+        volatile uint32_t ID_PFR[2]; //!< Processor feature registers.
+        volatile uint32_t ID_DFR; //!< Debug feature register.
+        volatile uint32_t ID_AFR; //!< Auxiliary feature register.
+        volatile uint32_t ID_MMFR[4]; //!< Memory model feature registers.
+        volatile uint32_t ID_ISAR[5]; //!< Instruction set attribute registers.
+        volatile uint32_t RESERVED0;
+        volatile uint32_t CLIDR; //!< Cache level ID register.
+        volatile uint32_t CTR; //!< Cache type register.
+        volatile uint32_t CCSIDR; //!< Cache size ID register (of the cache selected by CSSELR).
+        volatile uint32_t CSSELR; //!< Cache size selection register.
+        volatile uint32_t CPACR; //!< Coprocessor access control register.
+        volatile uint32_t RESERVED3[93];
+        volatile uint32_t STIR; //!< Software triggered interrupt register.
+        volatile uint32_t RESERVED4[19];
+        volatile uint32_t ICIALLU; //!< Invalidate entire instruction cache to the point of unification (write-only).
+        volatile uint32_t RESERVED5;
+        volatile uint32_t ICIMVAU; //!< Invalidate instruction cache line by address to the point of unification (write-only).
+        volatile uint32_t DCIMVAC; //!< Invalidate data cache line by address to the point of coherency (write-only).
+        volatile uint32_t DCISW; //!< Invalidate data cache line by set/way (write-only).
+        volatile uint32_t DCCMVAU; //!< Clean data cache line by address to the point of unification (write-only).
+        volatile uint32_t DCCMVAC; //!< Clean data cache line by address to the point of coherency (write-only).
+        volatile uint32_t DCCSW; //!< Clean data cache line by set/way (write-only).
+        volatile uint32_t DCCIMVAC; //!< Clean and invalidate data cache line by address to the point of coherency (write-only).
+        volatile uint32_t DCCISW; //!< Clean and invalidate data cache line by set/way (write-only).
+        volatile uint32_t BPIALL; //!< Invalidate all branch predictor entries (write-only, ignored on Cortex-M7).
+        volatile uint32_t RESERVED6[5];
+        volatile uint32_t ITCMCR; //!< Instruction TCM control register.
+        volatile uint32_t DTCMCR; //!< Data TCM control register.
+        volatile uint32_t AHBPCR; //!< AHB peripheral port control register.
+        volatile uint32_t CACR; //!< L1 cache control register.
+        volatile uint32_t AHBSCR; //!< AHB slave port control register.
+        volatile uint32_t RESERVED7;
+        volatile uint32_t ABFSR; //!< Auxiliary bus fault status register.
+    };
+
+    //! Processor part number, version, and implementation information.
+    union CPUID {
+        struct Bits {
+            uint32_t REVISION: 4; //!< Patch release (p in Rnpn).
+            uint32_t PARTNO: 12; //!< Part number (0xC27: Cortex-M7).
+            uint32_t ARCHITECTURE: 4; //!< Architecture (0xF: ARMv7E-M).
+            uint32_t VARIANT: 4; //!< Variant number (r in Rnpn).
+            uint32_t IMPLEMENTER: 8; //!< Implementer code (0x41: ARM).
+        } bits;
+
+        static constexpr Field<CPUID, 0, 4, FieldAccess::RO> REVISION_FIELD {};
+        static constexpr Field<CPUID, 4, 12, FieldAccess::RO> PARTNO_FIELD {};
+        static constexpr Field<CPUID, 16, 4, FieldAccess::RO> ARCHITECTURE_FIELD {};
+        static constexpr Field<CPUID, 20, 4, FieldAccess::RO> VARIANT_FIELD {};
+        static constexpr Field<CPUID, 24, 8, FieldAccess::RO> IMPLEMENTER_FIELD {};
+
+        uint32_t value = 0;
+
+        CPUID() = default;
+
+        CPUID(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Interrupt control and state register.
+    //! Provides set/clear-pending bits for PendSV and SysTick exceptions.
+    //! Provides set-pending bit for NMI exception.
+    //! Indicates active and pending exception numbers.
+    //! \note Do not simultaneously set both set and clear bits for the same exception.
+    union ICSR {
+        struct Bits {
+            uint32_t VECTACTIVE: 9; //!< Active exception number.
+            uint32_t RESERVED0: 2;
+            uint32_t RETTOBASE: 1; //!< No preempted active exceptions.
+            uint32_t VECTPENDING: 9; //!< Highest priority pending exception number (0: none).
+            uint32_t RESERVED1: 1;
+            uint32_t ISRPENDING: 1; //!< Interrupt pending (excluding NMI and faults).
+            uint32_t ISRPREEMPT: 1; //!< Preempted exception is active.
+            uint32_t RESERVED2: 1;
+            uint32_t PENDSTCLR: 1; //!< Write 1 to clear SysTick pending state (write-only).
+            uint32_t PENDSTSET: 1; //!< SysTick pending (read), write 1 to set pending.
+            uint32_t PENDSVCLR: 1; //!< Write 1 to clear PendSV pending state (write-only).
+            uint32_t PENDSVSET: 1; //!< PendSV pending (read), write 1 to set pending.
+            uint32_t RESERVED3: 2;
+            uint32_t NMIPENDSET: 1; //!< NMI pending (read), write 1 to set pending.
+        } bits;
+
+        static constexpr uint32_t WRITE_ONE_MASK = 0x9E000000u; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<ICSR, 0, 9, FieldAccess::RO> VECTACTIVE_FIELD {};
+        static constexpr Field<ICSR, 11, 1, FieldAccess::RO> RETTOBASE_FIELD {};
+        static constexpr Field<ICSR, 12, 9, FieldAccess::RO> VECTPENDING_FIELD {};
+        static constexpr Field<ICSR, 22, 1, FieldAccess::RO> ISRPENDING_FIELD {};
+        static constexpr Field<ICSR, 23, 1, FieldAccess::RO> ISRPREEMPT_FIELD {};
+        static constexpr Field<ICSR, 25, 1, FieldAccess::W1C> PENDSTCLR_FIELD {};
+        static constexpr Field<ICSR, 26, 1, FieldAccess::W1S> PENDSTSET_FIELD {};
+        static constexpr Field<ICSR, 27, 1, FieldAccess::W1C> PENDSVCLR_FIELD {};
+        static constexpr Field<ICSR, 28, 1, FieldAccess::W1S> PENDSVSET_FIELD {};
+        static constexpr Field<ICSR, 31, 1, FieldAccess::W1S> NMIPENDSET_FIELD {};
+
+        uint32_t value = 0;
+
+        ICSR() = default;
+
+        ICSR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+
+    //! Application interrupt and reset control register.
+    union AIRCR {
+        static constexpr uint16_t VECTKEY_VALUE = 0x05FA; //!< Write key to enable AIRCR writes.
+
+        struct Bits {
+            uint32_t VECTRESET: 1; //!< System reset bit (deprecated, write 0).
+            uint32_t VECTCLRACTIVE: 1; //!< Clear all active state information for exceptions (write 0).
+            uint32_t SYSRESETREQ: 1; //!< System reset request.
+            uint32_t RESERVED0: 5;
+            uint32_t PRIGROUP: 3; //!< Priority grouping (interrupt preemption level).
+            uint32_t RESERVED1: 4;
+            uint32_t ENDIANNESS: 1; //!< Data endianness (0: little endian).
+            uint32_t VECTKEY: 16; //!< Write VECTKEY_VALUE to enable writes, otherwise ignored.
+        } bits;
+
+        static constexpr uint32_t WRITE_KEY = uint32_t{VECTKEY_VALUE} << 16; //!< Inserted by modify() and write().
+        static constexpr uint32_t WRITE_KEY_MASK = 0xFFFF0000u;
+
+        static constexpr Field<AIRCR, 0, 1> VECTRESET_FIELD {};
+        static constexpr Field<AIRCR, 1, 1> VECTCLRACTIVE_FIELD {};
+        static constexpr Field<AIRCR, 2, 1> SYSRESETREQ_FIELD {};
+        static constexpr Field<AIRCR, 8, 3> PRIGROUP_FIELD {};
+        static constexpr Field<AIRCR, 15, 1, FieldAccess::RO> ENDIANNESS_FIELD {};
+
+        uint32_t value = 0;
+
+        AIRCR() = default;
+
+        AIRCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! System control register - low power state configuration.
+    union SCR {
+        struct Bits {
+            uint32_t RESERVED0: 1;
+            uint32_t SLEEPONEXIT: 1; //!< Enter sleep/deep sleep on ISR return to Thread mode.
+            uint32_t SLEEPDEEP: 1; //!< Use deep sleep instead of sleep.
+            uint32_t RESERVED1: 1;
+            uint32_t SEVONPEND: 1; //!< Wake from WFE on any interrupt (including disabled).
+            uint32_t RESERVED2: 27;
+        } bits;
+
+        static constexpr Field<SCR, 1, 1> SLEEPONEXIT_FIELD {};
+        static constexpr Field<SCR, 2, 1> SLEEPDEEP_FIELD {};
+        static constexpr Field<SCR, 4, 1> SEVONPEND_FIELD {};
+
+        uint32_t value = 0;
+
+        SCR() = default;
+
+        SCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Configuration and control register.
+    union CCR {
+        struct Bits {
+            uint32_t NONBASETHRDENA: 1; //!< Allow Thread mode with active exceptions.
+            uint32_t USERSETMPEND: 1; //!< Allow unprivileged software to access STIR.
+            uint32_t RESERVED0: 1;
+            uint32_t UNALIGN_TRP: 1; //!< Trap on unaligned word/halfword access.
+            uint32_t DIV_0_TRP: 1; //!< Trap on divide by zero.
+            uint32_t RESERVED1: 3;
+            uint32_t BFHFNMIGN: 1; //!< Handlers with priority -1 or -2 ignore data bus faults.
+            uint32_t STKALIGN: 1; //!< 8-byte stack alignment on exception entry.
+            uint32_t RESERVED2: 6;
+            uint32_t DC: 1; //!< L1 data cache enable.
+            uint32_t IC: 1; //!< L1 instruction cache enable.
+            uint32_t BP: 1; //!< Branch prediction enable (always enabled on Cortex-M7, RAO/WI).
+            uint32_t RESERVED3: 13;
+        } bits;
+
+        static constexpr Field<CCR, 0, 1> NONBASETHRDENA_FIELD {};
+        static constexpr Field<CCR, 1, 1> USERSETMPEND_FIELD {};
+        static constexpr Field<CCR, 3, 1> UNALIGN_TRP_FIELD {};
+        static constexpr Field<CCR, 4, 1> DIV_0_TRP_FIELD {};
+        static constexpr Field<CCR, 8, 1> BFHFNMIGN_FIELD {};
+        static constexpr Field<CCR, 9, 1> STKALIGN_FIELD {};
+        static constexpr Field<CCR, 16, 1> DC_FIELD {};
+        static constexpr Field<CCR, 17, 1> IC_FIELD {};
+        static constexpr Field<CCR, 18, 1, FieldAccess::RO> BP_FIELD {};
+
+        uint32_t value = 0;
+
+        CCR() = default;
+
+        CCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! System handler control and state register.
+    union SHCSR {
+        struct Bits {
+            uint32_t MEMFAULTACT: 1; //!< MemManage fault exception active.
+            uint32_t BUSFAULTACT: 1; //!< BusFault exception active.
+            uint32_t RESERVED0: 1;
+            uint32_t USGFAULTACT: 1; //!< UsageFault exception active.
+            uint32_t RESERVED1: 3;
+            uint32_t SVCALLACT: 1; //!< SVCall active.
+            uint32_t MONITORACT: 1; //!< Debug monitor active.
+            uint32_t RESERVED2: 1;
+            uint32_t PENDSVACT: 1; //!< PendSV exception active.
+            uint32_t SYSTICKACT: 1; //!< SysTick exception active.
+            uint32_t USGFAULTPENDED: 1; //!< UsageFault exception pending.
+            uint32_t MEMFAULTPENDED: 1; //!< MemManage fault exception pending.
+            uint32_t BUSFAULTPENDED: 1; //!< BusFault exception pending.
+            uint32_t SVCALLPENDED: 1; //!< SVCall pending.
+            uint32_t MEMFAULTENA: 1; //!< MemManage fault enable.
+            uint32_t BUSFAULTENA: 1; //!< BusFault enable.
+            uint32_t USGFAULTENA: 1; //!< UsageFault enable.
+            uint32_t RESERVED3: 13;
+        } bits;
+
+        static constexpr Field<SHCSR, 0, 1> MEMFAULTACT_FIELD {};
+        static constexpr Field<SHCSR, 1, 1> BUSFAULTACT_FIELD {};
+        static constexpr Field<SHCSR, 3, 1> USGFAULTACT_FIELD {};
+        static constexpr Field<SHCSR, 7, 1> SVCALLACT_FIELD {};
+        static constexpr Field<SHCSR, 8, 1> MONITORACT_FIELD {};
+        static constexpr Field<SHCSR, 10, 1> PENDSVACT_FIELD {};
+        static constexpr Field<SHCSR, 11, 1> SYSTICKACT_FIELD {};
+        static constexpr Field<SHCSR, 12, 1> USGFAULTPENDED_FIELD {};
+        static constexpr Field<SHCSR, 13, 1> MEMFAULTPENDED_FIELD {};
+        static constexpr Field<SHCSR, 14, 1> BUSFAULTPENDED_FIELD {};
+        static constexpr Field<SHCSR, 15, 1> SVCALLPENDED_FIELD {};
+        static constexpr Field<SHCSR, 16, 1> MEMFAULTENA_FIELD {};
+        static constexpr Field<SHCSR, 17, 1> BUSFAULTENA_FIELD {};
+        static constexpr Field<SHCSR, 18, 1> USGFAULTENA_FIELD {};
+
+        uint32_t value = 0;
+
+        SHCSR() = default;
+
+        SHCSR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Configurable fault status register.
+    //! Combines MemManage, BusFault, and UsageFault status registers.
+    //! All status bits are W1C (write-1-to-clear).
+    union CFSR {
+        struct Bits {
+            // MemManage Fault Status Register (MMFSR) - bits 0:7
+            uint32_t IACCVIOL: 1; //!< Instruction access violation.
+            uint32_t DACCVIOL: 1; //!< Data access violation.
+            uint32_t RESERVED0: 1;
+            uint32_t MUNSTKERR: 1; //!< MemManage fault on unstacking.
+            uint32_t MSTKERR: 1; //!< MemManage fault on stacking.
+            uint32_t MLSPERR: 1; //!< MemManage fault during floating-point lazy state preservation.
+            uint32_t RESERVED1: 1;
+            uint32_t MMARVALID: 1; //!< MemManage fault address register valid.
+
+            // BusFault Status Register (BFSR) - bits 8:15
+            uint32_t IBUSERR: 1; //!< Instruction bus error.
+            uint32_t PRECISERR: 1; //!< Precise data bus error.
+            uint32_t IMPRECISERR: 1; //!< Imprecise data bus error.
+            uint32_t UNSTKERR: 1; //!< BusFault on unstacking.
+            uint32_t STKERR: 1; //!< BusFault on stacking.
+            uint32_t LSPERR: 1; //!< BusFault during floating-point lazy state preservation.
+            uint32_t RESERVED2: 1;
+            uint32_t BFARVALID: 1; //!< BusFault address register valid.
+
+            // UsageFault Status Register (UFSR) - bits 16:31
+            uint32_t UNDEFINSTR: 1; //!< Undefined instruction.
+            uint32_t INVSTATE: 1; //!< Invalid state (e.g., ARM mode).
+            uint32_t INVPC: 1; //!< Invalid PC load.
+            uint32_t NOCP: 1; //!< No coprocessor.
+            uint32_t RESERVED3: 4;
+            uint32_t UNALIGNED: 1; //!< Unaligned access.
+            uint32_t DIVBYZERO: 1; //!< Divide by zero.
+            uint32_t RESERVED4: 6;
+        } bits;
+
+        static constexpr uint32_t WRITE_ONE_MASK = 0x030FBFBBu; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<CFSR, 0, 1, FieldAccess::W1C> IACCVIOL_FIELD {};
+        static constexpr Field<CFSR, 1, 1, FieldAccess::W1C> DACCVIOL_FIELD {};
+        static constexpr Field<CFSR, 3, 1, FieldAccess::W1C> MUNSTKERR_FIELD {};
+        static constexpr Field<CFSR, 4, 1, FieldAccess::W1C> MSTKERR_FIELD {};
+        static constexpr Field<CFSR, 5, 1, FieldAccess::W1C> MLSPERR_FIELD {};
+        static constexpr Field<CFSR, 7, 1, FieldAccess::W1C> MMARVALID_FIELD {};
+        static constexpr Field<CFSR, 8, 1, FieldAccess::W1C> IBUSERR_FIELD {};
+        static constexpr Field<CFSR, 9, 1, FieldAccess::W1C> PRECISERR_FIELD {};
+        static constexpr Field<CFSR, 10, 1, FieldAccess::W1C> IMPRECISERR_FIELD {};
+        static constexpr Field<CFSR, 11, 1, FieldAccess::W1C> UNSTKERR_FIELD {};
+        static constexpr Field<CFSR, 12, 1, FieldAccess::W1C> STKERR_FIELD {};
+        static constexpr Field<CFSR, 13, 1, FieldAccess::W1C> LSPERR_FIELD {};
+        static constexpr Field<CFSR, 15, 1, FieldAccess::W1C> BFARVALID_FIELD {};
+        static constexpr Field<CFSR, 16, 1, FieldAccess::W1C> UNDEFINSTR_FIELD {};
+        static constexpr Field<CFSR, 17, 1, FieldAccess::W1C> INVSTATE_FIELD {};
+        static constexpr Field<CFSR, 18, 1, FieldAccess::W1C> INVPC_FIELD {};
+        static constexpr Field<CFSR, 19, 1, FieldAccess::W1C> NOCP_FIELD {};
+        static constexpr Field<CFSR, 24, 1, FieldAccess::W1C> UNALIGNED_FIELD {};
+        static constexpr Field<CFSR, 25, 1, FieldAccess::W1C> DIVBYZERO_FIELD {};
+
+        uint32_t value = 0;
+
+        CFSR() = default;
+
+        CFSR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! HardFault status register.
+    //! All status bits are W1C (write-1-to-clear).
+    union HFSR {
+        struct Bits {
+            uint32_t RESERVED0: 1;
+            uint32_t VECTTBL: 1; //!< Vector table read fault.
+            uint32_t RESERVED1: 28;
+            uint32_t FORCED: 1; //!< Forced HardFault (escalated configurable fault).
+            uint32_t DEBUGEVT: 1; //!< Debug event HardFault.
+        } bits;
+
+        static constexpr uint32_t WRITE_ONE_MASK = 0xC0000002u; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<HFSR, 1, 1, FieldAccess::W1C> VECTTBL_FIELD {};
+        static constexpr Field<HFSR, 30, 1, FieldAccess::W1C> FORCED_FIELD {};
+        static constexpr Field<HFSR, 31, 1, FieldAccess::W1C> DEBUGEVT_FIELD {};
+
+        uint32_t value = 0;
+
+        HFSR() = default;
+
+        HFSR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Debug fault status register.
+    //! All status bits are W1C (write-1-to-clear).
+    union DFSR {
+        struct Bits {
+            uint32_t HALTED: 1; //!< Halt request debug event.
+            uint32_t BKPT: 1; //!< Breakpoint debug event.
+            uint32_t DWTTRAP: 1; //!< Data Watchpoint and Trace (DWT) debug event.
+            uint32_t VCATCH: 1; //!< Vector catch debug event.
+            uint32_t EXTERNAL: 1; //!< External debug request.
+            uint32_t RESERVED: 27;
+        } bits;
+
+        static constexpr uint32_t WRITE_ONE_MASK = 0x0000001Fu; //!< Write-one bits, never written back by modify().
+
+        static constexpr Field<DFSR, 0, 1, FieldAccess::W1C> HALTED_FIELD {};
+        static constexpr Field<DFSR, 1, 1, FieldAccess::W1C> BKPT_FIELD {};
+        static constexpr Field<DFSR, 2, 1, FieldAccess::W1C> DWTTRAP_FIELD {};
+        static constexpr Field<DFSR, 3, 1, FieldAccess::W1C> VCATCH_FIELD {};
+        static constexpr Field<DFSR, 4, 1, FieldAccess::W1C> EXTERNAL_FIELD {};
+
+        uint32_t value = 0;
+
+        DFSR() = default;
+
+        DFSR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Coprocessor access control register.
+    //! Controls access to coprocessors CP0-CP15.
+    //! On Cortex-M7 with FPU, CP10 and CP11 control access to the floating-point unit.
+    union CPACR {
+        //! Coprocessor access privilege values.
+        enum class Access : uint8_t {
+            DENIED = 0b00, //!< Access denied (generates UsageFault).
+            PRIVILEGED = 0b01, //!< Privileged access only.
+            RESERVED = 0b10, //!< Reserved.
+            FULL = 0b11 //!< Full access.
+        };
+
+        struct Bits {
+            uint32_t CP0: 2; //!< Coprocessor 0 access.
+            uint32_t CP1: 2; //!< Coprocessor 1 access.
+            uint32_t CP2: 2; //!< Coprocessor 2 access.
+            uint32_t CP3: 2; //!< Coprocessor 3 access.
+            uint32_t CP4: 2; //!< Coprocessor 4 access.
+            uint32_t CP5: 2; //!< Coprocessor 5 access.
+            uint32_t CP6: 2; //!< Coprocessor 6 access.
+            uint32_t CP7: 2; //!< Coprocessor 7 access.
+            uint32_t RESERVED0: 4;
+            uint32_t CP10: 2; //!< Coprocessor 10 access (FPU).
+            uint32_t CP11: 2; //!< Coprocessor 11 access (FPU).
+            uint32_t RESERVED1: 8;
+        } bits;
+
+        static constexpr Field<CPACR, 0, 2> CP0_FIELD {};
+        static constexpr Field<CPACR, 2, 2> CP1_FIELD {};
+        static constexpr Field<CPACR, 4, 2> CP2_FIELD {};
+        static constexpr Field<CPACR, 6, 2> CP3_FIELD {};
+        static constexpr Field<CPACR, 8, 2> CP4_FIELD {};
+        static constexpr Field<CPACR, 10, 2> CP5_FIELD {};
+        static constexpr Field<CPACR, 12, 2> CP6_FIELD {};
+        static constexpr Field<CPACR, 14, 2> CP7_FIELD {};
+        static constexpr Field<CPACR, 20, 2> CP10_FIELD {};
+        static constexpr Field<CPACR, 22, 2> CP11_FIELD {};
+
+        uint32_t value = 0;
+
+        CPACR() = default;
+
+        CPACR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Cache level ID register.
+    union CLIDR {
+        //! Type of cache implemented at a level.
+        enum class CacheType : uint8_t {
+            NONE = 0b000, //!< No cache.
+            INSTRUCTION = 0b001, //!< Instruction cache only.
+            DATA = 0b010, //!< Data cache only.
+            SEPARATE = 0b011 //!< Separate instruction and data caches.
+        };
+
+        struct Bits {
+            uint32_t CL1: 3; //!< Level 1 cache type (CacheType).
+            uint32_t CL2: 3; //!< Level 2 cache type (CacheType).
+            uint32_t CL3: 3; //!< Level 3 cache type (CacheType).
+            uint32_t CL4: 3; //!< Level 4 cache type (CacheType).
+            uint32_t CL5: 3; //!< Level 5 cache type (CacheType).
+            uint32_t CL6: 3; //!< Level 6 cache type (CacheType).
+            uint32_t CL7: 3; //!< Level 7 cache type (CacheType).
+            uint32_t LOUIS: 3; //!< Level of unification inner shareable.
+            uint32_t LOC: 3; //!< Level of coherency.
+            uint32_t LOUU: 3; //!< Level of unification uniprocessor.
+            uint32_t RESERVED: 2;
+        } bits;
+
+        static constexpr Field<CLIDR, 0, 3, FieldAccess::RO> CL1_FIELD {};
+        static constexpr Field<CLIDR, 21, 3, FieldAccess::RO> LOUIS_FIELD {};
+        static constexpr Field<CLIDR, 24, 3, FieldAccess::RO> LOC_FIELD {};
+        static constexpr Field<CLIDR, 27, 3, FieldAccess::RO> LOUU_FIELD {};
+
+        uint32_t value = 0;
+
+        CLIDR() = default;
+
+        CLIDR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Cache type register.
+    union CTR {
+        struct Bits {
+            uint32_t IMINLINE: 4; //!< Log2 of the smallest instruction cache line in words.
+            uint32_t RESERVED0: 12;
+            uint32_t DMINLINE: 4; //!< Log2 of the smallest data cache line in words.
+            uint32_t ERG: 4; //!< Log2 of the exclusives reservation granule in words.
+            uint32_t CWG: 4; //!< Log2 of the cache writeback granule in words.
+            uint32_t RESERVED1: 1;
+            uint32_t FORMAT: 3; //!< Register format (0b100: ARMv7).
+        } bits;
+
+        static constexpr Field<CTR, 0, 4, FieldAccess::RO> IMINLINE_FIELD {};
+        static constexpr Field<CTR, 16, 4, FieldAccess::RO> DMINLINE_FIELD {};
+        static constexpr Field<CTR, 20, 4, FieldAccess::RO> ERG_FIELD {};
+        static constexpr Field<CTR, 24, 4, FieldAccess::RO> CWG_FIELD {};
+        static constexpr Field<CTR, 29, 3, FieldAccess::RO> FORMAT_FIELD {};
+
+        uint32_t value = 0;
+
+        CTR() = default;
+
+        CTR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Cache size ID register.
+    //! Describes the geometry of the cache selected by CSSELR.
+    union CCSIDR {
+        struct Bits {
+            uint32_t LINESIZE: 3; //!< Log2 of the number of words in a cache line, minus two.
+            uint32_t ASSOCIATIVITY: 10; //!< Number of ways, minus one.
+            uint32_t NUMSETS: 15; //!< Number of sets, minus one.
+            uint32_t WA: 1; //!< Write-allocation supported.
+            uint32_t RA: 1; //!< Read-allocation supported.
+            uint32_t WB: 1; //!< Write-back supported.
+            uint32_t WT: 1; //!< Write-through supported.
+        } bits;
+
+        static constexpr Field<CCSIDR, 0, 3, FieldAccess::RO> LINESIZE_FIELD {};
+        static constexpr Field<CCSIDR, 3, 10, FieldAccess::RO> ASSOCIATIVITY_FIELD {};
+        static constexpr Field<CCSIDR, 13, 15, FieldAccess::RO> NUMSETS_FIELD {};
+        static constexpr Field<CCSIDR, 28, 1, FieldAccess::RO> WA_FIELD {};
+        static constexpr Field<CCSIDR, 29, 1, FieldAccess::RO> RA_FIELD {};
+        static constexpr Field<CCSIDR, 30, 1, FieldAccess::RO> WB_FIELD {};
+        static constexpr Field<CCSIDR, 31, 1, FieldAccess::RO> WT_FIELD {};
+
+        uint32_t value = 0;
+
+        CCSIDR() = default;
+
+        CCSIDR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Cache size selection register.
+    //! Selects the cache described by CCSIDR.
+    union CSSELR {
+        struct Bits {
+            uint32_t IND: 1; //!< Select the instruction cache (1) or the data/unified cache (0).
+            uint32_t LEVEL: 3; //!< Cache level, minus one.
+            uint32_t RESERVED: 28;
+        } bits;
+
+        static constexpr Field<CSSELR, 0, 1> IND_FIELD {};
+        static constexpr Field<CSSELR, 1, 3> LEVEL_FIELD {};
+
+        uint32_t value = 0;
+
+        CSSELR() = default;
+
+        CSSELR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Instruction and data TCM control register (ITCMCR, DTCMCR).
+    //! Both registers share the same layout, the TCM size is fixed by the implementation.
+    union TCMCR {
+        struct Bits {
+            uint32_t EN: 1; //!< TCM enable, accesses to the TCM region go to the AXI master when disabled.
+            uint32_t RMW: 1; //!< Read-modify-write enable, required for sub-word writes when the TCM has ECC.
+            uint32_t RETEN: 1; //!< Retry phase enable, reads are retried after a correctable ECC error.
+            uint32_t SZ: 4; //!< TCM size (0: no TCM, otherwise 512 << SZ bytes).
+            uint32_t RESERVED: 25;
+        } bits;
+
+        static constexpr Field<TCMCR, 0, 1> EN_FIELD {};
+        static constexpr Field<TCMCR, 1, 1> RMW_FIELD {};
+        static constexpr Field<TCMCR, 2, 1> RETEN_FIELD {};
+        static constexpr Field<TCMCR, 3, 4, FieldAccess::RO> SZ_FIELD {};
+
+        uint32_t value = 0;
+
+        TCMCR() = default;
+
+        TCMCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! AHB peripheral port control register.
+    union AHBPCR {
+        struct Bits {
+            uint32_t EN: 1; //!< AHBP enable, accesses to the AHBP region go to the AXI master when disabled.
+            uint32_t SZ: 3; //!< AHBP region size (0: disabled, otherwise 32 MB << SZ).
+            uint32_t RESERVED: 28;
+        } bits;
+
+        static constexpr Field<AHBPCR, 0, 1> EN_FIELD {};
+        static constexpr Field<AHBPCR, 1, 3, FieldAccess::RO> SZ_FIELD {};
+
+        uint32_t value = 0;
+
+        AHBPCR() = default;
+
+        AHBPCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! L1 cache control register.
+    union CACR {
+        struct Bits {
+            uint32_t SIWT: 1; //!< Treat shared cacheable memory as write-through.
+            uint32_t ECCDIS: 1; //!< Disable ECC in the instruction and data caches.
+            uint32_t FORCEWT: 1; //!< Force write-through for all cacheable memory.
+            uint32_t RESERVED: 29;
+        } bits;
+
+        static constexpr Field<CACR, 0, 1> SIWT_FIELD {};
+        static constexpr Field<CACR, 1, 1> ECCDIS_FIELD {};
+        static constexpr Field<CACR, 2, 1> FORCEWT_FIELD {};
+
+        uint32_t value = 0;
+
+        CACR() = default;
+
+        CACR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! AHB slave port control register.
+    //! Arbitrates TCM accesses between the processor and the AHB slave port (e.g. DMA into DTCM).
+    union AHBSCR {
+        struct Bits {
+            uint32_t CTL: 2; //!< Priority control between the AHB slave port and the processor.
+            uint32_t TPRI: 9; //!< Threshold execution priority for demoting AHB slave traffic.
+            uint32_t INITCOUNT: 5; //!< Fairness counter initialisation value.
+            uint32_t RESERVED: 16;
+        } bits;
+
+        static constexpr Field<AHBSCR, 0, 2> CTL_FIELD {};
+        static constexpr Field<AHBSCR, 2, 9> TPRI_FIELD {};
+        static constexpr Field<AHBSCR, 11, 5> INITCOUNT_FIELD {};
+
+        uint32_t value = 0;
+
+        AHBSCR() = default;
+
+        AHBSCR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Auxiliary bus fault status register.
+    //! Records the interface an asynchronous BusFault came from, bits are cleared by writing 0.
+    union ABFSR {
+        //! AXI response type of an AXIM fault.
+        enum class AxiType : uint8_t {
+            OKAY = 0b00, //!< Normal access success.
+            EXOKAY = 0b01, //!< Exclusive access success.
+            SLVERR = 0b10, //!< Slave error.
+            DECERR = 0b11 //!< Decode error.
+        };
+
+        struct Bits {
+            uint32_t ITCM: 1; //!< Fault on the ITCM interface.
+            uint32_t DTCM: 1; //!< Fault on the DTCM interface.
+            uint32_t AHBP: 1; //!< Fault on the AHB peripheral interface.
+            uint32_t AXIM: 1; //!< Fault on the AXI master interface.
+            uint32_t EPPB: 1; //!< Fault on the external private peripheral bus.
+            uint32_t RESERVED0: 3;
+            uint32_t AXIMTYPE: 2; //!< AXI response type (AxiType), valid with AXIM.
+            uint32_t RESERVED1: 22;
+        } bits;
+
+        static constexpr Field<ABFSR, 0, 1> ITCM_FIELD {};
+        static constexpr Field<ABFSR, 1, 1> DTCM_FIELD {};
+        static constexpr Field<ABFSR, 2, 1> AHBP_FIELD {};
+        static constexpr Field<ABFSR, 3, 1> AXIM_FIELD {};
+        static constexpr Field<ABFSR, 4, 1> EPPB_FIELD {};
+        static constexpr Field<ABFSR, 8, 2, FieldAccess::RO> AXIMTYPE_FIELD {};
+
+        uint32_t value = 0;
+
+        ABFSR() = default;
+
+        ABFSR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+}
+
+namespace ArmCortex {
+    inline volatile Scb::Registers* const SCB = reinterpret_cast<volatile Scb::Registers*>(Scb::BASE_ADDRESS);
+}
+
+namespace ArmCortex::Scb {
+    [[gnu::noreturn, gnu::always_inline]] static inline void systemReset()
+    {
+        asmDsb();
+
+        AIRCR aircr { SCB->AIRCR };
+
+        aircr.bits.VECTRESET = 0;
+        aircr.bits.VECTCLRACTIVE = 0;
+        aircr.bits.SYSRESETREQ = true;
+        aircr.bits.VECTKEY = AIRCR::VECTKEY_VALUE;
+
+        SCB->AIRCR = aircr.value;
+
+        asmDsb();
+        asmIsb();
+
+        while(true);
+    }
+
+    [[gnu::always_inline]] static inline void setPriorityGrouping(uint32_t priority_group)
+    {
+        asmDsb();
+
+        AIRCR aircr { SCB->AIRCR };
+
+        aircr.bits.PRIGROUP = priority_group & 0x7;
+        aircr.bits.VECTKEY = AIRCR::VECTKEY_VALUE;
+
+        SCB->AIRCR = aircr.value;
+
+        asmDsb();
+        asmIsb();
+    }
+
+    [[gnu::always_inline]] static inline uint32_t getPriorityGrouping()
+    {
+        AIRCR aircr { SCB->AIRCR };
+        return aircr.bits.PRIGROUP;
+    }
+
+    // =========================================================================
+    // ICSR W1S/W1C Helper Functions
+    // =========================================================================
+
+    //! Check if SysTick exception is pending.
+    [[gnu::always_inline]] static inline bool isSysTickPending()
+    {
+        ICSR icsr { SCB->ICSR };
+        return icsr.bits.PENDSTSET;
+    }
+
+    //! Set SysTick exception pending. PENDSTSET is W1S (write-1-to-set).
+    [[gnu::always_inline]] static inline void setSysTickPending()
+    {
+        constexpr uint32_t PENDSTSET_BIT = uint32_t{1} << 26;
+        SCB->ICSR = PENDSTSET_BIT;
+    }
+
+    //! Clear SysTick exception pending. PENDSTCLR is W1C (write-1-to-clear).
+    [[gnu::always_inline]] static inline void clearSysTickPending()
+    {
+        constexpr uint32_t PENDSTCLR_BIT = uint32_t{1} << 25;
+        SCB->ICSR = PENDSTCLR_BIT;
+    }
+
+    //! Check if PendSV exception is pending.
+    [[gnu::always_inline]] static inline bool isPendSVPending()
+    {
+        ICSR icsr { SCB->ICSR };
+        return icsr.bits.PENDSVSET;
+    }
+
+    //! Set PendSV exception pending. PENDSVSET is W1S (write-1-to-set).
+    [[gnu::always_inline]] static inline void setPendSV()
+    {
+        constexpr uint32_t PENDSVSET_BIT = uint32_t{1} << 28;
+        SCB->ICSR = PENDSVSET_BIT;
+    }
+
+    //! Clear PendSV exception pending. PENDSVCLR is W1C (write-1-to-clear).
+    [[gnu::always_inline]] static inline void clearPendSV()
+    {
+        constexpr uint32_t PENDSVCLR_BIT = uint32_t{1} << 27;
+        SCB->ICSR = PENDSVCLR_BIT;
+    }
+
+    //! Check if NMI exception is pending.
+    [[gnu::always_inline]] static inline bool isNMIPending()
+    {
+        ICSR icsr { SCB->ICSR };
+        return icsr.bits.NMIPENDSET;
+    }
+
+    //! Trigger NMI exception. NMIPENDSET is W1S (write-1-to-set).
+    //! \note NMI cannot be cleared by software once set.
+    [[gnu::always_inline]] static inline void triggerNMI()
+    {
+        constexpr uint32_t NMIPENDSET_BIT = uint32_t{1} << 31;
+        SCB->ICSR = NMIPENDSET_BIT;
+    }
+
+    // =========================================================================
+    // CFSR W1C Helper Functions (Configurable Fault Status)
+    // =========================================================================
+
+    //! Get the current configurable fault status.
+    [[gnu::always_inline]] static inline CFSR getFaultStatus()
+    {
+        return CFSR { SCB->CFSR };
+    }
+
+    //! Clear all MemManage fault flags. All MMFSR bits are W1C.
+    [[gnu::always_inline]] static inline void clearMemManageFaults()
+    {
+        constexpr uint32_t MMFSR_W1C_MASK = 0xBBu;  // bits 0,1,3,4,5,7
+        SCB->CFSR = MMFSR_W1C_MASK;
+    }
+
+    //! Clear all BusFault flags. All BFSR bits are W1C.
+    [[gnu::always_inline]] static inline void clearBusFaults()
+    {
+        constexpr uint32_t BFSR_W1C_MASK = 0xBF00u;  // bits 8,9,10,11,12,13,15
+        SCB->CFSR = BFSR_W1C_MASK;
+    }
+
+    //! Clear all UsageFault flags. All UFSR bits are W1C.
+    [[gnu::always_inline]] static inline void clearUsageFaults()
+    {
+        constexpr uint32_t UFSR_W1C_MASK = 0x030F0000u;  // bits 16,17,18,19,24,25
+        SCB->CFSR = UFSR_W1C_MASK;
+    }
+
+    //! Clear all configurable fault flags (MemManage, BusFault, UsageFault).
+    [[gnu::always_inline]] static inline void clearAllConfigurableFaults()
+    {
+        constexpr uint32_t CFSR_W1C_MASK = 0x030FBFBBu;  // all W1C bits
+        SCB->CFSR = CFSR_W1C_MASK;
+    }
+
+    // =========================================================================
+    // HFSR W1C Helper Functions (HardFault Status)
+    // =========================================================================
+
+    //! Get the current HardFault status.
+    [[gnu::always_inline]] static inline HFSR getHardFaultStatus()
+    {
+        return HFSR { SCB->HFSR };
+    }
+
+    //! Clear all HardFault status flags. All HFSR status bits are W1C.
+    [[gnu::always_inline]] static inline void clearHardFaultStatus()
+    {
+        constexpr uint32_t HFSR_W1C_MASK = 0xC0000002u;  // bits 1, 30, 31
+        SCB->HFSR = HFSR_W1C_MASK;
+    }
+
+    // =========================================================================
+    // DFSR W1C Helper Functions (Debug Fault Status)
+    // =========================================================================
+
+    //! Get the current debug fault status.
+    [[gnu::always_inline]] static inline DFSR getDebugFaultStatus()
+    {
+        return DFSR { SCB->DFSR };
+    }
+
+    //! Clear all debug fault status flags. All DFSR bits are W1C.
+    [[gnu::always_inline]] static inline void clearDebugFaultStatus()
+    {
+        constexpr uint32_t DFSR_W1C_MASK = 0x1Fu;  // bits 0-4
+        SCB->DFSR = DFSR_W1C_MASK;
+    }
+}
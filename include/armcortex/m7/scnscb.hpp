@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::ScnScb {
+    inline constexpr uintptr_t BASE_ADDRESS = 0xE000E000u;
+
+    struct Registers
+    {
+        volatile uint32_t RESERVED0; //!< Reserved.
+        volatile uint32_t ICTR; //!< Interrupt controller type register.
+        volatile uint32_t ACTLR; //!< Auxiliary control register.
+    };
+
+    //! Interrupt controller type register.
+    union ICTR {
+        struct Bits {
+            uint32_t INTLINESNUM: 4; //!< Number of implemented interrupt lines in groups of 32, minus one.
+            uint32_t RESERVED: 28;
+        } bits;
+
+        static constexpr Field<ICTR, 0, 4, FieldAccess::RO> INTLINESNUM_FIELD {};
+
+        uint32_t value = 0;
+
+        ICTR() = default;
+
+        ICTR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+
+    //! Auxiliary control register.
+    //! Trades performance for determinism or easier debugging, all bits are 0 (full performance) after reset.
+    //! Their cost can be measured with Dwt::CycleScope around the affected code.
+    union ACTLR {
+        struct Bits {
+            //! Disable interruption of LDM/STM and multi-cycle multiply/divide instructions.
+            //! Interrupt latency grows by up to the length of the longest such instruction,
+            //! in exchange LDM/STM are never abandoned and restarted.
+            uint32_t DISMCYCINT: 1;
+            uint32_t RESERVED0: 1;
+            //! Disable IT instruction folding.
+            //! IT instructions then take an issue slot of their own, making conditional code slightly slower.
+            uint32_t DISFOLD: 1;
+            uint32_t RESERVED1: 7;
+            //! Disable FPU exception outputs to the system.
+            uint32_t FPEXCODIS: 1;
+            //! Disable dynamic read allocate mode for write-back write-allocate memory.
+            //! Large memset/memcpy-like store streams then allocate lines in the data cache instead of
+            //! bypassing it, evicting useful data.
+            uint32_t DISRAMODE: 1;
+            //! Disable the ITM and DWT ATB flush.
+            uint32_t DISITMATBFLUSH: 1;
+            //! Disable the branch target address cache.
+            //! Every taken branch then pays the full branch penalty.
+            uint32_t DISBTACREAD: 1;
+            //! Disable new allocations into the branch target address cache, existing entries keep being used.
+            uint32_t DISBTACALLOC: 1;
+            //! Disable critical AXI read-under-read.
+            //! A second AXI read waits for the first one, lowering the throughput from external memory.
+            uint32_t DISCRITAXIRUR: 1;
+            //! Disable dual-issue, one bit per instruction class.
+            //! Each set bit roughly halves the throughput of the affected instruction pairs, useful to
+            //! make cycle counts comparable across code layouts.
+            uint32_t DISDI: 5;
+            //! Disable direct issue on the second pipeline channel, one bit per instruction class.
+            uint32_t DISISSCH1: 5;
+            //! Disable dynamic allocation of ADD and SUB instructions to the early or late ALU.
+            uint32_t DISDYNADD: 1;
+            uint32_t RESERVED2: 5;
+        } bits;
+
+        static constexpr Field<ACTLR, 0, 1> DISMCYCINT_FIELD {};
+        static constexpr Field<ACTLR, 2, 1> DISFOLD_FIELD {};
+        static constexpr Field<ACTLR, 10, 1> FPEXCODIS_FIELD {};
+        static constexpr Field<ACTLR, 11, 1> DISRAMODE_FIELD {};
+        static constexpr Field<ACTLR, 12, 1> DISITMATBFLUSH_FIELD {};
+        static constexpr Field<ACTLR, 13, 1> DISBTACREAD_FIELD {};
+        static constexpr Field<ACTLR, 14, 1> DISBTACALLOC_FIELD {};
+        static constexpr Field<ACTLR, 15, 1> DISCRITAXIRUR_FIELD {};
+        static constexpr Field<ACTLR, 16, 5> DISDI_FIELD {};
+        static constexpr Field<ACTLR, 21, 5> DISISSCH1_FIELD {};
+        static constexpr Field<ACTLR, 26, 1> DISDYNADD_FIELD {};
+
+        uint32_t value = 0;
+
+        ACTLR() = default;
+
+        ACTLR(uint32_t new_value)
+        {
+            value = new_value;
+        }
+    };
+}
+
+namespace ArmCortex {
+    inline volatile ScnScb::Registers* const SCN_SCB = reinterpret_cast<volatile ScnScb::Registers*>(ScnScb::BASE_ADDRESS);
+}
+
+namespace ArmCortex::ScnScb {
+    //! Number of implemented interrupt lines, rounded up to a multiple of 32.
+    [[gnu::always_inline]] static inline uint32_t getNumOfIrqLines()
+    {
+        return (read<ICTR>(SCN_SCB->ICTR, ICTR::INTLINESNUM_FIELD) + 1) * 32;
+    }
+}
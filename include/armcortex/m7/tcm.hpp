@@ -0,0 +1,149 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+
+#pragma once
+
+#include "armcortex/intrinsics/barriers.hpp"
+#include "armcortex/m7/scb.hpp"
+#include "armcortex/register_field.hpp"
+#include <cstdint>
+
+namespace ArmCortex::Tcm {
+    //! Tightly-coupled memories are accessed with zero wait states and never cached, so they suit hot
+    //! interrupt handlers, their data, and DMA buffers that would otherwise need cache maintenance.
+    //! \note ITCM is out of BL range of flash, functions placed in it that are called (not only reached
+    //!       through the vector table) also need [[gnu::long_call]].
+    inline constexpr uintptr_t ITCM_BASE_ADDRESS = 0x00000000u;
+    inline constexpr uintptr_t DTCM_BASE_ADDRESS = 0x20000000u;
+
+    //! Size in bytes encoded in the SZ field of ITCMCR or DTCMCR.
+    [[gnu::always_inline]] constexpr uint32_t sizeFromField(uint32_t size_field)
+    {
+        return (size_field == 0) ? 0 : (512u << size_field);
+    }
+
+    //! Size of the ITCM in bytes, 0 if not implemented.
+    [[gnu::always_inline]] static inline uint32_t getItcmSize()
+    {
+        return sizeFromField(read<Scb::TCMCR>(SCB->ITCMCR, Scb::TCMCR::SZ_FIELD));
+    }
+
+    //! Size of the DTCM in bytes, 0 if not implemented.
+    [[gnu::always_inline]] static inline uint32_t getDtcmSize()
+    {
+        return sizeFromField(read<Scb::TCMCR>(SCB->DTCMCR, Scb::TCMCR::SZ_FIELD));
+    }
+
+    //! Check if the ITCM is enabled.
+    [[gnu::always_inline]] static inline bool isItcmEnabled()
+    {
+        return read<Scb::TCMCR>(SCB->ITCMCR, Scb::TCMCR::EN_FIELD) != 0;
+    }
+
+    //! Check if the DTCM is enabled.
+    [[gnu::always_inline]] static inline bool isDtcmEnabled()
+    {
+        return read<Scb::TCMCR>(SCB->DTCMCR, Scb::TCMCR::EN_FIELD) != 0;
+    }
+
+    //! Enable the ITCM.
+    //! \param read_modify_write Enable read-modify-write of sub-word writes, required when the TCM has ECC.
+    //! \param retry Retry reads after a correctable ECC error.
+    //! \note Usually already enabled at reset by the INITTCMEN inputs, check the device documentation.
+    [[gnu::always_inline]] static inline void enableItcm(bool read_modify_write = false, bool retry = false)
+    {
+        asmDsb();
+        asmIsb();
+        modify<Scb::TCMCR>(SCB->ITCMCR, Scb::TCMCR::EN_FIELD(1), Scb::TCMCR::RMW_FIELD(read_modify_write), Scb::TCMCR::RETEN_FIELD(retry));
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Disable the ITCM, its address range is then forwarded to the AXI master.
+    [[gnu::always_inline]] static inline void disableItcm()
+    {
+        asmDsb();
+        asmIsb();
+        modify<Scb::TCMCR>(SCB->ITCMCR, Scb::TCMCR::EN_FIELD(0));
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Enable the DTCM.
+    //! \param read_modify_write Enable read-modify-write of sub-word writes, required when the TCM has ECC.
+    //! \param retry Retry reads after a correctable ECC error.
+    //! \note Usually already enabled at reset by the INITTCMEN inputs, check the device documentation.
+    [[gnu::always_inline]] static inline void enableDtcm(bool read_modify_write = false, bool retry = false)
+    {
+        asmDsb();
+        asmIsb();
+        modify<Scb::TCMCR>(SCB->DTCMCR, Scb::TCMCR::EN_FIELD(1), Scb::TCMCR::RMW_FIELD(read_modify_write), Scb::TCMCR::RETEN_FIELD(retry));
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Disable the DTCM, its address range is then forwarded to the AXI master.
+    [[gnu::always_inline]] static inline void disableDtcm()
+    {
+        asmDsb();
+        asmIsb();
+        modify<Scb::TCMCR>(SCB->DTCMCR, Scb::TCMCR::EN_FIELD(0));
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Copy the load image of a section (e.g. .itcm_text or .dtcm_data) from flash to its run address.
+    //! Code and data are placed in TCM with section attributes, e.g. [[gnu::section(".itcm_text")]] on
+    //! a function and [[gnu::section(".dtcm_data")]] on a variable, which the linker script maps to the
+    //! TCM regions with a load address in flash:
+    //! \code
+    //! .itcm_text : { __itcm_text_start = .; *(.itcm_text*) __itcm_text_end = .; } > ITCM AT > FLASH
+    //! __itcm_text_load = LOADADDR(.itcm_text);
+    //! \endcode
+    //! The barriers make copied code visible to instruction fetches, no cache maintenance is needed
+    //! because TCM is not cached.
+    //! \param begin First word of the section at its run address.
+    //! \param end One past the last word of the section at its run address.
+    //! \param load First word of the section at its load address.
+    [[gnu::always_inline]] static inline void loadSection(uint32_t* begin, const uint32_t* end, const uint32_t* load)
+    {
+        while (begin < end) {
+            *begin++ = *load++;
+        }
+
+        asmDsb();
+        asmIsb();
+    }
+
+    //! Clear a section without a load image (e.g. .dtcm_bss).
+    //! \param begin First word of the section.
+    //! \param end One past the last word of the section.
+    [[gnu::always_inline]] static inline void zeroSection(uint32_t* begin, const uint32_t* end)
+    {
+        while (begin < end) {
+            *begin++ = 0;
+        }
+    }
+
+    //! Enable the AHB peripheral port, accesses to its region (configured by the device) bypass the AXI master.
+    [[gnu::always_inline]] static inline void enableAhbPeripheralPort()
+    {
+        modify<Scb::AHBPCR>(SCB->AHBPCR, Scb::AHBPCR::EN_FIELD(1));
+        asmDsb();
+        asmIsb();
+    }
+}
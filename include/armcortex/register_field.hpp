@@ -0,0 +1,163 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include "armcortex/bit_utils.hpp"
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace ArmCortex {
+    //! Software access type of a register field.
+    enum class FieldAccess : uint8_t {
+        RW, //!< Read-write.
+        RO, //!< Read-only, writes are ignored.
+        W1C, //!< Writing 1 clears the state or performs the action, writing 0 has no effect.
+        W1S //!< Writing 1 sets the state or performs the action, writing 0 has no effect.
+    };
+
+    //! Compile-time descriptor of a register field.
+    //! \tparam Reg Register union the field belongs to.
+    //! \tparam pos Position of the least significant bit of the field.
+    //! \tparam width Number of bits in the field.
+    //! \tparam access Software access type.
+    template<typename Reg, uint8_t pos, uint8_t width, FieldAccess access = FieldAccess::RW>
+    struct Field {
+        static_assert(width > 0 && pos + width <= 32, "Field does not fit into a 32-bit register.");
+
+        using Register = Reg;
+
+        static constexpr uint8_t POSITION = pos;
+        static constexpr uint8_t WIDTH = width;
+        static constexpr FieldAccess ACCESS = access;
+        static constexpr uint32_t MASK = FIELD_MASK<uint32_t, pos, width>;
+
+        //! Field value shifted into its register position.
+        struct Value {
+            using FieldType = Field;
+
+            uint32_t bits;
+        };
+
+        //! Creates a field value for modify() and write().
+        template<typename T>
+        constexpr Value operator()(T field_value) const
+        {
+            static_assert(access != FieldAccess::RO, "Read-only fields cannot be written.");
+            return Value { (static_cast<uint32_t>(field_value) << pos) & MASK };
+        }
+
+        //! Extracts the field from a register value.
+        static constexpr uint32_t get(uint32_t register_value)
+        {
+            return extractField<pos, width>(register_value);
+        }
+    };
+
+    //! Bits of a register that must never be written back from a read value
+    //! (write-one-to-clear and write-one-to-set bits).
+    //! Registers declare them as static constexpr uint32_t WRITE_ONE_MASK.
+    template<typename Reg>
+    inline constexpr uint32_t WRITE_ONE_MASK_OF = [] {
+        if constexpr (requires { Reg::WRITE_ONE_MASK; }) {
+            return Reg::WRITE_ONE_MASK;
+        } else {
+            return 0u;
+        }
+    }();
+
+    //! Key that must accompany every write to a register (e.g. AIRCR VECTKEY), already shifted into position.
+    //! Registers declare it as static constexpr uint32_t WRITE_KEY and WRITE_KEY_MASK.
+    template<typename Reg>
+    inline constexpr uint32_t WRITE_KEY_OF = [] {
+        if constexpr (requires { Reg::WRITE_KEY; }) {
+            return Reg::WRITE_KEY;
+        } else {
+            return 0u;
+        }
+    }();
+
+    template<typename Reg>
+    inline constexpr uint32_t WRITE_KEY_MASK_OF = [] {
+        if constexpr (requires { Reg::WRITE_KEY_MASK; }) {
+            return Reg::WRITE_KEY_MASK;
+        } else {
+            return 0u;
+        }
+    }();
+
+    //! Checks that a field descriptor covers exactly the bits of the matching Bits member,
+    //! so the two descriptions of a register cannot drift apart.
+    //! \code
+    //! static_assert(matchesBitfield(Scb::SCR::SLEEPDEEP_FIELD, [](auto& bits, uint32_t ones) { bits.SLEEPDEEP = ones; }));
+    //! \endcode
+    template<typename FieldType, typename SetBitfield>
+    consteval bool matchesBitfield(FieldType, SetBitfield set_bitfield)
+    {
+        typename FieldType::Register::Bits bits {};
+        set_bitfield(bits, ~0u);
+        return std::bit_cast<uint32_t>(bits) == FieldType::MASK;
+    }
+
+    //! Reads a single field of a register.
+    //! \tparam Reg Register union of reg, the field must belong to it.
+    template<typename Reg, typename FieldType>
+    [[gnu::always_inline]] static inline uint32_t read(const volatile uint32_t& reg, FieldType)
+    {
+        static_assert(std::is_same_v<Reg, typename FieldType::Register>, "Field does not belong to the register.");
+
+        return FieldType::get(reg);
+    }
+
+    //! Value that modify() stores when the register currently holds register_value.
+    //! \tparam Reg Register union, all fields must belong to it.
+    template<typename Reg, typename First, typename... Rest>
+    [[gnu::always_inline]] static constexpr uint32_t modifiedValue(uint32_t register_value, First first, Rest... rest)
+    {
+        static_assert((std::is_same_v<Reg, typename First::FieldType::Register> && ... && std::is_same_v<Reg, typename Rest::FieldType::Register>),
+            "All fields must belong to the register.");
+
+        constexpr uint32_t KEEP_MASK = ~(First::FieldType::MASK | (Rest::FieldType::MASK | ... | 0u) | WRITE_ONE_MASK_OF<Reg> | WRITE_KEY_MASK_OF<Reg>);
+        return (register_value & KEEP_MASK) | first.bits | (rest.bits | ... | 0u) | WRITE_KEY_OF<Reg>;
+    }
+
+    //! Updates several fields of a register with a single load and store.
+    //! All masks are merged at compile time. Write-one bits of the register are written as 0 unless
+    //! given, so pending or status flags are not accidentally set or cleared, and the register write key
+    //! is inserted automatically.
+    //! \tparam Reg Register union of reg, all fields must belong to it.
+    //! \code
+    //! modify<Scb::SCR>(SCB->SCR, Scb::SCR::SLEEPDEEP_FIELD(1), Scb::SCR::SLEEPONEXIT_FIELD(0));
+    //! \endcode
+    template<typename Reg, typename First, typename... Rest>
+    [[gnu::always_inline]] static inline void modify(volatile uint32_t& reg, First first, Rest... rest)
+    {
+        reg = modifiedValue<Reg>(reg, first, rest...);
+    }
+
+    //! Writes the given fields to a register without reading it first, all other bits are written as 0.
+    //! Intended for registers made of write-one bits (e.g. ICSR, CFSR) and for full initialisation.
+    //! \tparam Reg Register union of reg, all fields must belong to it.
+    template<typename Reg, typename First, typename... Rest>
+    [[gnu::always_inline]] static inline void write(volatile uint32_t& reg, First first, Rest... rest)
+    {
+        static_assert((std::is_same_v<Reg, typename First::FieldType::Register> && ... && std::is_same_v<Reg, typename Rest::FieldType::Register>),
+            "All fields must belong to the register.");
+
+        reg = first.bits | (rest.bits | ... | 0u) | WRITE_KEY_OF<Reg>;
+    }
+}
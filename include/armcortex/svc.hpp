@@ -0,0 +1,145 @@
+/*
+    Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+    Licensed under the Apache Licence, Version 2.0 (the "Licence");
+    you may not use this file except in compliance with the Licence.
+    You may obtain a copy of the Licence at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the Licence is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the Licence for the specific language governing permissions and
+    limitations under the Licence.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+
+namespace ArmCortex::Svc {
+    //! Registers stacked by the processor on exception entry.
+    struct StackFrame {
+        uint32_t r0; //!< First argument, result on return.
+        uint32_t r1; //!< Second argument, second result on return.
+        uint32_t r2; //!< Third argument.
+        uint32_t r3; //!< Fourth argument.
+        uint32_t r12;
+        uint32_t lr;
+        uint32_t pc; //!< Return address, points after the SVC instruction.
+        uint32_t xpsr;
+    };
+
+    //! Service routine. Reads arguments from frame.r0-r3 and writes results to frame.r0-r1,
+    //! which are restored into the caller's registers on exception return.
+    using Handler = void (*)(StackFrame& frame);
+
+    inline constexpr uint32_t MAX_NUM_OF_SERVICES = 256;
+
+    //! Immediate value of the SVC instruction that raised the exception.
+    //! The 16-bit Thumb SVC encoding (0xDFxx) keeps it in the low byte of the halfword before the stacked PC.
+    [[gnu::always_inline]] static inline uint8_t getImmediate(const StackFrame& frame)
+    {
+        return *reinterpret_cast<const uint8_t*>(frame.pc - 2);
+    }
+
+    //! Calls the handler registered for the SVC immediate, unknown or empty entries are ignored.
+    //! \tparam table Constant array of up to 256 handlers indexed by the SVC immediate.
+    template<const auto& table>
+    void dispatch(StackFrame* frame)
+    {
+        static_assert(std::size(table) <= MAX_NUM_OF_SERVICES, "SVC immediate is limited to 0-255.");
+
+        uint8_t service = getImmediate(*frame);
+
+        if (service < std::size(table)) {
+            Handler handler = table[service];
+
+            if (handler != nullptr) {
+                handler(*frame);
+            }
+        }
+    }
+
+    //! SVCall exception entry. Call it as the only statement of a naked SVC_Handler:
+    //! \code
+    //! constexpr ArmCortex::Svc::Handler SERVICES[] = { &getTicks, &yield };
+    //! extern "C" [[gnu::naked]] void SVC_Handler() { ArmCortex::Svc::handlerEntry<SERVICES>(); }
+    //! \endcode
+    //! Selects MSP or PSP from EXC_RETURN bit 2 and passes the stack frame to dispatch().
+    //! Uses ARMv6-M instructions only, so it works on all Cortex-M cores.
+    template<const auto& table>
+    [[gnu::always_inline]] static inline void handlerEntry()
+    {
+        asm volatile(
+            "movs r0, #4\n\t"
+            "mov r1, lr\n\t"
+            "tst r0, r1\n\t"
+            "beq 1f\n\t"
+            "mrs r0, psp\n\t"
+            "b 2f\n"
+            "1:\n\t"
+            "mrs r0, msp\n"
+            "2:\n\t"
+            "push {r4, lr}\n\t"
+            "bl %c0\n\t"
+            "pop {r4, pc}"
+            : : "i" (&dispatch<table>)
+        );
+    }
+
+    //! Supervisor call without arguments.
+    //! \tparam service SVC immediate (0-255).
+    //! \return Value written to frame.r0 by the service routine.
+    template<uint8_t service>
+    [[gnu::always_inline]] static inline uint32_t call()
+    {
+        register uint32_t r0 asm("r0");
+        asm volatile("svc %1" : "=r" (r0) : "i" (static_cast<uint16_t>(service)) : "r1", "memory");
+        return r0;
+    }
+
+    //! Supervisor call with one argument passed in R0.
+    template<uint8_t service>
+    [[gnu::always_inline]] static inline uint32_t call(uint32_t arg0)
+    {
+        register uint32_t r0 asm("r0") = arg0;
+        asm volatile("svc %1" : "+r" (r0) : "i" (static_cast<uint16_t>(service)) : "r1", "memory");
+        return r0;
+    }
+
+    //! Supervisor call with two arguments passed in R0-R1.
+    template<uint8_t service>
+    [[gnu::always_inline]] static inline uint32_t call(uint32_t arg0, uint32_t arg1)
+    {
+        register uint32_t r0 asm("r0") = arg0;
+        register uint32_t r1 asm("r1") = arg1;
+        asm volatile("svc %2" : "+r" (r0), "+r" (r1) : "i" (static_cast<uint16_t>(service)) : "memory");
+        return r0;
+    }
+
+    //! Supervisor call with three arguments passed in R0-R2.
+    template<uint8_t service>
+    [[gnu::always_inline]] static inline uint32_t call(uint32_t arg0, uint32_t arg1, uint32_t arg2)
+    {
+        register uint32_t r0 asm("r0") = arg0;
+        register uint32_t r1 asm("r1") = arg1;
+        register uint32_t r2 asm("r2") = arg2;
+        asm volatile("svc %3" : "+r" (r0), "+r" (r1), "+r" (r2) : "i" (static_cast<uint16_t>(service)) : "memory");
+        return r0;
+    }
+
+    //! Supervisor call with four arguments passed in R0-R3.
+    template<uint8_t service>
+    [[gnu::always_inline]] static inline uint32_t call(uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+    {
+        register uint32_t r0 asm("r0") = arg0;
+        register uint32_t r1 asm("r1") = arg1;
+        register uint32_t r2 asm("r2") = arg2;
+        register uint32_t r3 asm("r3") = arg3;
+        asm volatile("svc %4" : "+r" (r0), "+r" (r1), "+r" (r2), "+r" (r3) : "i" (static_cast<uint16_t>(service)) : "memory");
+        return r0;
+    }
+}
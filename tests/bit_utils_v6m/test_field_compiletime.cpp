@@ -0,0 +1,61 @@
+#include "armcortex/bit_utils.hpp"
+
+static_assert(ArmCortex::FIELD_MASK<uint32_t, 4, 3> == 0x00000070u);
+static_assert(ArmCortex::FIELD_MASK<uint32_t, 0, 32> == 0xFFFFFFFFu);
+static_assert(ArmCortex::FIELD_MASK<uint8_t, 4, 4> == 0xF0u);
+
+static_assert(ArmCortex::extractField<4, 3>(0x000000F0u) == 7u);
+static_assert(ArmCortex::extractField<24, 8>(0xA5000000u) == 0xA5u);
+static_assert(ArmCortex::extractField<0, 32>(0xDEADBEEFu) == 0xDEADBEEFu);
+static_assert(ArmCortex::extractField<1, 2>(uint8_t{0x06}) == 3u);
+
+static_assert(ArmCortex::extractSignedField<4, 3>(0x00000070u) == -1);
+static_assert(ArmCortex::extractSignedField<4, 3>(0x00000030u) == 3);
+static_assert(ArmCortex::extractSignedField<28, 4>(0x80000000u) == -8);
+static_assert(ArmCortex::extractSignedField<4, 4>(uint8_t{0x80}) == -8);
+
+constexpr uint32_t insertFieldResult(uint32_t value, uint32_t field)
+{
+    ArmCortex::insertField<8, 4>(value, field);
+    return value;
+}
+
+static_assert(insertFieldResult(0xFFFFFFFFu, 0x5u) == 0xFFFFF5FFu);
+static_assert(insertFieldResult(0x00000000u, 0x1Fu) == 0x00000F00u);
+
+constexpr uint32_t insertSignedFieldResult(uint32_t value, int32_t field)
+{
+    ArmCortex::insertSignedField<8, 4>(value, field);
+    return value;
+}
+
+static_assert(insertSignedFieldResult(0x00000000u, -1) == 0x00000F00u);
+static_assert(insertSignedFieldResult(0x00000000u, -8) == 0x00000800u);
+
+constexpr uint32_t clearFieldResult(uint32_t value)
+{
+    ArmCortex::clearField<8, 4>(value);
+    return value;
+}
+
+static_assert(clearFieldResult(0xFFFFFFFFu) == 0xFFFFF0FFu);
+
+extern "C" [[gnu::naked]] uint32_t test_extract_field_compiletime() {
+    constexpr uint32_t result = ArmCortex::extractField<4, 3>(0x000000F0u);
+    return result;
+}
+
+// CHECK-LABEL: <test_extract_field_compiletime>:
+// CHECK-NEXT: movs r0, #7
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_insert_field_compiletime() {
+    constexpr uint32_t result = insertFieldResult(0x00000000u, 0x5u) >> 4;
+    return result;
+}
+
+// CHECK-LABEL: <test_insert_field_compiletime>:
+// CHECK-NEXT: movs r0, #80
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
@@ -0,0 +1,39 @@
+#include "armcortex/bit_utils.hpp"
+
+extern "C" [[gnu::naked]] uint32_t test_extract_field_runtime_4_3(uint32_t value) {
+    return ArmCortex::extractField<4, 3>(value);
+}
+
+// CHECK-LABEL: <test_extract_field_runtime_4_3>:
+// CHECK-NEXT: lsls r0, r0, #25
+// CHECK-NEXT: lsrs r0, r0, #29
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_extract_field_runtime_20_9(uint32_t value) {
+    return ArmCortex::extractField<20, 9>(value);
+}
+
+// CHECK-LABEL: <test_extract_field_runtime_20_9>:
+// CHECK-NEXT: lsls r0, r0, #3
+// CHECK-NEXT: lsrs r0, r0, #23
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_extract_signed_field_runtime_4_3(uint32_t value) {
+    return ArmCortex::extractSignedField<4, 3>(value);
+}
+
+// CHECK-LABEL: <test_extract_signed_field_runtime_4_3>:
+// CHECK-NEXT: lsls r0, r0, #25
+// CHECK-NEXT: asrs r0, r0, #29
+// CHECK-EMPTY:
+
+// Test insertField() - no bitfield insert on ARMv6-M, mask and merge
+extern "C" uint32_t test_insert_field_runtime_8_4(uint32_t value, uint32_t field) {
+    ArmCortex::insertField<8, 4>(value, field);
+    return value;
+}
+
+// CHECK-LABEL: <test_insert_field_runtime_8_4>:
+// CHECK: lsls
+// CHECK: orrs
+// CHECK: bx lr
@@ -0,0 +1,48 @@
+#include "armcortex/bit_utils.hpp"
+
+static_assert(ArmCortex::maskOf<>() == 0u);
+static_assert(ArmCortex::maskOf<0>() == 0x00000001u);
+static_assert(ArmCortex::maskOf<0, 3, 7>() == 0x00000089u);
+static_assert(ArmCortex::maskOf<31, 16, 0>() == 0x80010001u);
+
+constexpr uint32_t setBitsResult(uint32_t value)
+{
+    ArmCortex::setBits<0, 3, 7>(value);
+    return value;
+}
+
+constexpr uint32_t clearBitsResult(uint32_t value)
+{
+    ArmCortex::clearBits<0, 3, 7>(value);
+    return value;
+}
+
+constexpr uint32_t assignBitsResult(uint32_t value, uint32_t mask, uint32_t new_bits)
+{
+    ArmCortex::assignBits(value, mask, new_bits);
+    return value;
+}
+
+static_assert(setBitsResult(0x00000000u) == 0x00000089u);
+static_assert(clearBitsResult(0xFFFFFFFFu) == 0xFFFFFF76u);
+static_assert(assignBitsResult(0x12345678u, 0x0000FF00u, 0xFFFFABFFu) == 0x1234AB78u);
+
+extern "C" [[gnu::naked]] uint32_t test_set_bits_compiletime() {
+    constexpr uint32_t result = setBitsResult(0x00000000u);
+    return result;
+}
+
+// CHECK-LABEL: <test_set_bits_compiletime>:
+// CHECK-NEXT: movs r0, #137
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_clear_bits_compiletime() {
+    constexpr uint32_t result = clearBitsResult(0x000000FFu);
+    return result;
+}
+
+// CHECK-LABEL: <test_clear_bits_compiletime>:
+// CHECK-NEXT: movs r0, #118
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
@@ -0,0 +1,50 @@
+#include "armcortex/bit_utils.hpp"
+
+extern "C" [[gnu::naked]] uint32_t test_set_bits_runtime_0_3_7(uint32_t value) {
+    ArmCortex::setBits<0, 3, 7>(value);
+    return value;
+}
+
+// CHECK-LABEL: <test_set_bits_runtime_0_3_7>:
+// CHECK-NEXT: movs r3, #137
+// CHECK-NEXT: orrs r0, r3
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_set_bits_runtime_0_1_2_3_4(uint32_t value) {
+    ArmCortex::setBits<0, 1, 2, 3, 4>(value);
+    return value;
+}
+
+// CHECK-LABEL: <test_set_bits_runtime_0_1_2_3_4>:
+// CHECK-NEXT: movs r3, #31
+// CHECK-NEXT: orrs r0, r3
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_clear_bits_runtime_0_3_7(uint32_t value) {
+    ArmCortex::clearBits<0, 3, 7>(value);
+    return value;
+}
+
+// CHECK-LABEL: <test_clear_bits_runtime_0_3_7>:
+// CHECK-NEXT: movs r3, #137
+// CHECK-NEXT: bics r0, r3
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_clear_bits_runtime_1_2_3_4_5(uint32_t value) {
+    ArmCortex::clearBits<1, 2, 3, 4, 5>(value);
+    return value;
+}
+
+// CHECK-LABEL: <test_clear_bits_runtime_1_2_3_4_5>:
+// CHECK-NEXT: movs r3, #62
+// CHECK-NEXT: bics r0, r3
+// CHECK-EMPTY:
+
+extern "C" uint32_t test_assign_bits_runtime(uint32_t value, uint32_t new_bits) {
+    ArmCortex::assignBits(value, 0x000000F0u, new_bits);
+    return value;
+}
+
+// CHECK-LABEL: <test_assign_bits_runtime>:
+// CHECK-NOT: {{ldr|str}}
+// CHECK: bx lr
@@ -0,0 +1,98 @@
+#include "armcortex/bit_utils.hpp"
+
+static_assert(ArmCortex::countLeadingZeros(0x00000000u) == 32);
+static_assert(ArmCortex::countLeadingZeros(0x00000001u) == 31);
+static_assert(ArmCortex::countLeadingZeros(0x00010000u) == 15);
+static_assert(ArmCortex::countLeadingZeros(0x7FFFFFFFu) == 1);
+static_assert(ArmCortex::countLeadingZeros(0x80000000u) == 0);
+static_assert(ArmCortex::countLeadingZeros(0xFFFFFFFFu) == 0);
+
+static_assert(ArmCortex::countTrailingZeros(0x00000000u) == 32);
+static_assert(ArmCortex::countTrailingZeros(0x00000001u) == 0);
+static_assert(ArmCortex::countTrailingZeros(0x00010000u) == 16);
+static_assert(ArmCortex::countTrailingZeros(0xFFFF0000u) == 16);
+static_assert(ArmCortex::countTrailingZeros(0x80000000u) == 31);
+
+static_assert(ArmCortex::findFirstSet(0x00000000u) == 0);
+static_assert(ArmCortex::findFirstSet(0x00000001u) == 1);
+static_assert(ArmCortex::findFirstSet(0x00000018u) == 4);
+static_assert(ArmCortex::findFirstSet(0x80000000u) == 32);
+
+static_assert(ArmCortex::reverseBits(0x00000001u) == 0x80000000u);
+static_assert(ArmCortex::reverseBits(0x12345678u) == 0x1E6A2C48u);
+static_assert(ArmCortex::reverseBits(0xFFFF0000u) == 0x0000FFFFu);
+
+static_assert(ArmCortex::byteSwap32(0x12345678u) == 0x78563412u);
+static_assert(ArmCortex::byteSwap16(uint16_t{0x1234}) == 0x3412);
+static_assert(ArmCortex::byteSwapSigned16(int16_t{0x0080}) == -32768);
+static_assert(ArmCortex::byteSwapSigned16(int16_t{0x7F00}) == 0x007F);
+
+extern "C" [[gnu::naked]] uint32_t test_clz_compiletime() {
+    constexpr uint32_t result = ArmCortex::countLeadingZeros(0x00010000u);
+    return result;
+}
+
+// CHECK-LABEL: <test_clz_compiletime>:
+// CHECK-NEXT: movs r0, #15
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_ctz_compiletime() {
+    constexpr uint32_t result = ArmCortex::countTrailingZeros(0x00010000u);
+    return result;
+}
+
+// CHECK-LABEL: <test_ctz_compiletime>:
+// CHECK-NEXT: movs r0, #16
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_ffs_compiletime() {
+    constexpr uint32_t result = ArmCortex::findFirstSet(0x00000018u);
+    return result;
+}
+
+// CHECK-LABEL: <test_ffs_compiletime>:
+// CHECK-NEXT: movs r0, #4
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_rbit_compiletime() {
+    constexpr uint32_t result = ArmCortex::reverseBits(0x80000000u);
+    return result;
+}
+
+// CHECK-LABEL: <test_rbit_compiletime>:
+// CHECK-NEXT: movs r0, #1
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_byte_swap_32_compiletime() {
+    constexpr uint32_t result = ArmCortex::byteSwap32(0x12000000u);
+    return result;
+}
+
+// CHECK-LABEL: <test_byte_swap_32_compiletime>:
+// CHECK-NEXT: movs r0, #18
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint16_t test_byte_swap_16_compiletime() {
+    constexpr uint16_t result = ArmCortex::byteSwap16(uint16_t{0x3400});
+    return result;
+}
+
+// CHECK-LABEL: <test_byte_swap_16_compiletime>:
+// CHECK-NEXT: movs r0, #52
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int16_t test_byte_swap_signed_16_compiletime() {
+    constexpr int16_t result = ArmCortex::byteSwapSigned16(int16_t{0x7F00});
+    return result;
+}
+
+// CHECK-LABEL: <test_byte_swap_signed_16_compiletime>:
+// CHECK-NEXT: movs r0, #127
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
@@ -0,0 +1,60 @@
+#include "armcortex/bit_utils.hpp"
+
+extern "C" [[gnu::naked]] uint32_t test_clz_runtime(uint32_t value) {
+    return ArmCortex::countLeadingZeros(value);
+}
+
+// CHECK-LABEL: <test_clz_runtime>:
+// CHECK-NEXT: clz r0, r0
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_ctz_runtime(uint32_t value) {
+    return ArmCortex::countTrailingZeros(value);
+}
+
+// CHECK-LABEL: <test_ctz_runtime>:
+// CHECK-NEXT: rbit r0, r0
+// CHECK-NEXT: clz r0, r0
+// CHECK-EMPTY:
+
+// Test findFirstSet() - isolates the lowest set bit and counts from the top, no branches
+extern "C" uint32_t test_ffs_runtime(uint32_t value) {
+    return ArmCortex::findFirstSet(value);
+}
+
+// CHECK-LABEL: <test_ffs_runtime>:
+// CHECK-NOT: b{{(eq|ne)}}
+// CHECK: clz
+// CHECK-NOT: b{{(eq|ne)}}
+// CHECK: bx lr
+
+extern "C" [[gnu::naked]] uint32_t test_rbit_runtime(uint32_t value) {
+    return ArmCortex::reverseBits(value);
+}
+
+// CHECK-LABEL: <test_rbit_runtime>:
+// CHECK-NEXT: rbit r0, r0
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_byte_swap_32_runtime(uint32_t value) {
+    return ArmCortex::byteSwap32(value);
+}
+
+// CHECK-LABEL: <test_byte_swap_32_runtime>:
+// CHECK-NEXT: rev r0, r0
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint16_t test_byte_swap_16_runtime(uint16_t value) {
+    return ArmCortex::byteSwap16(value);
+}
+
+// CHECK-LABEL: <test_byte_swap_16_runtime>:
+// CHECK: rev16 r0, r0
+
+extern "C" [[gnu::naked]] int16_t test_byte_swap_signed_16_runtime(int16_t value) {
+    return ArmCortex::byteSwapSigned16(value);
+}
+
+// CHECK-LABEL: <test_byte_swap_signed_16_runtime>:
+// CHECK: revsh r0, r0
@@ -0,0 +1,96 @@
+#include "armcortex/bitset.hpp"
+
+static_assert(ArmCortex::populationCount(0x00000000u) == 0);
+static_assert(ArmCortex::populationCount(0x80000001u) == 2);
+static_assert(ArmCortex::populationCount(0xFFFFFFFFu) == 32);
+
+constexpr uint32_t sumOfSetBits(const ArmCortex::BitSet<256>& bits)
+{
+    uint32_t sum = 0;
+
+    for (uint32_t n : bits) {
+        sum += n;
+    }
+
+    return sum;
+}
+
+constexpr ArmCortex::BitSet<256> READY { 3, 64, 200, 255 };
+static_assert(READY.test(64) && !READY.test(65));
+static_assert(READY.count() == 4);
+static_assert(READY.findFirst() == 3);
+static_assert(READY.findLast() == 255);
+static_assert(READY.findNext(4) == 64);
+static_assert(READY.findNext(201) == 255);
+static_assert(sumOfSetBits(READY) == 3 + 64 + 200 + 255);
+static_assert(ArmCortex::BitSet<40>().findFirst() == ArmCortex::BitSet<40>::NOT_FOUND);
+
+constexpr ArmCortex::BitSet<40> allSet()
+{
+    ArmCortex::BitSet<40> bits;
+    bits.setAll();
+    return bits;
+}
+
+static_assert(allSet().count() == 40);
+static_assert(allSet().word(1) == 0xFFu);
+static_assert(allSet().findLast() == 39);
+
+// Test findFirst() on a single word - RBIT and CLZ, no library calls
+extern "C" uint32_t test_bitset_find_first_32(const ArmCortex::BitSet<32>& bits) {
+    return bits.findFirst();
+}
+
+// CHECK-LABEL: <test_bitset_find_first_32>:
+// CHECK-NOT: {{bl }}
+// CHECK: rbit
+// CHECK-NEXT: clz
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test findFirst() on 8 words - skips empty words, one RBIT/CLZ for the found word
+extern "C" uint32_t test_bitset_find_first_256(const ArmCortex::BitSet<256>& bits) {
+    return bits.findFirst();
+}
+
+// CHECK-LABEL: <test_bitset_find_first_256>:
+// CHECK-NOT: {{bl }}
+// CHECK: rbit
+// CHECK-NEXT: clz
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test findLast() on 32 words - CLZ only
+extern "C" uint32_t test_bitset_find_last_1024(const ArmCortex::BitSet<1024>& bits) {
+    return bits.findLast();
+}
+
+// CHECK-LABEL: <test_bitset_find_last_1024>:
+// CHECK-NOT: {{bl }}
+// CHECK-NOT: rbit
+// CHECK: clz
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test count() on 8 words - SWAR population count, no library calls
+extern "C" uint32_t test_bitset_count_256(const ArmCortex::BitSet<256>& bits) {
+    return bits.count();
+}
+
+// CHECK-LABEL: <test_bitset_count_256>:
+// CHECK-NOT: {{bl }}
+// CHECK: mul
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test set() with a run-time index - word index, shift and OR
+extern "C" void test_bitset_set_1024(ArmCortex::BitSet<1024>& bits, uint32_t n) {
+    bits.set(n);
+}
+
+// CHECK-LABEL: <test_bitset_set_1024>:
+// CHECK-NOT: {{bl }}
+// CHECK: lsr{{s?(\.w)?}} {{r[0-9]+}}, {{r[0-9]+}}, #5
+// CHECK: orr
+// CHECK: str
+// CHECK: bx lr
@@ -0,0 +1,52 @@
+#include "armcortex/bit_utils.hpp"
+
+extern "C" [[gnu::naked]] uint32_t test_extract_field_runtime_4_3(uint32_t value) {
+    return ArmCortex::extractField<4, 3>(value);
+}
+
+// CHECK-LABEL: <test_extract_field_runtime_4_3>:
+// CHECK-NEXT: ubfx r0, r0, #4, #3
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_extract_field_runtime_20_9(uint32_t value) {
+    return ArmCortex::extractField<20, 9>(value);
+}
+
+// CHECK-LABEL: <test_extract_field_runtime_20_9>:
+// CHECK-NEXT: ubfx r0, r0, #20, #9
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_extract_signed_field_runtime_4_3(uint32_t value) {
+    return ArmCortex::extractSignedField<4, 3>(value);
+}
+
+// CHECK-LABEL: <test_extract_signed_field_runtime_4_3>:
+// CHECK-NEXT: sbfx r0, r0, #4, #3
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_insert_field_runtime_8_4(uint32_t value, uint32_t field) {
+    ArmCortex::insertField<8, 4>(value, field);
+    return value;
+}
+
+// CHECK-LABEL: <test_insert_field_runtime_8_4>:
+// CHECK-NEXT: bfi r0, r1, #8, #4
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_clear_field_runtime_8_4(uint32_t value) {
+    ArmCortex::clearField<8, 4>(value);
+    return value;
+}
+
+// CHECK-LABEL: <test_clear_field_runtime_8_4>:
+// CHECK-NEXT: {{bfc r0, #8, #4|bic.w r0, r0, #3840}}
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_clear_field_runtime_5_13(uint32_t value) {
+    ArmCortex::clearField<5, 13>(value);
+    return value;
+}
+
+// CHECK-LABEL: <test_clear_field_runtime_5_13>:
+// CHECK-NEXT: bfc r0, #5, #13
+// CHECK-EMPTY:
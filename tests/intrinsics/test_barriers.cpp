@@ -0,0 +1,167 @@
+#include "armcortex/intrinsics/barriers.hpp"
+
+extern "C" [[gnu::naked]] void test_dsb_sy() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::SY>();
+}
+
+// CHECK-LABEL: <test_dsb_sy>:
+// CHECK-NEXT: dsb sy
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_st() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::ST>();
+}
+
+// CHECK-LABEL: <test_dsb_st>:
+// CHECK-NEXT: dsb st
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_ish() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::ISH>();
+}
+
+// CHECK-LABEL: <test_dsb_ish>:
+// CHECK-NEXT: dsb ish
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_ishst() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::ISHST>();
+}
+
+// CHECK-LABEL: <test_dsb_ishst>:
+// CHECK-NEXT: dsb ishst
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_nsh() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::NSH>();
+}
+
+// CHECK-LABEL: <test_dsb_nsh>:
+// CHECK-NEXT: dsb nsh
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_nshst() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::NSHST>();
+}
+
+// CHECK-LABEL: <test_dsb_nshst>:
+// CHECK-NEXT: dsb nshst
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_osh() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::OSH>();
+}
+
+// CHECK-LABEL: <test_dsb_osh>:
+// CHECK-NEXT: dsb osh
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_oshst() {
+    ArmCortex::asmDsb<ArmCortex::BarrierOption::OSHST>();
+}
+
+// CHECK-LABEL: <test_dsb_oshst>:
+// CHECK-NEXT: dsb oshst
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_sy() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::SY>();
+}
+
+// CHECK-LABEL: <test_dmb_sy>:
+// CHECK-NEXT: dmb sy
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_st() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::ST>();
+}
+
+// CHECK-LABEL: <test_dmb_st>:
+// CHECK-NEXT: dmb st
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_ish() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::ISH>();
+}
+
+// CHECK-LABEL: <test_dmb_ish>:
+// CHECK-NEXT: dmb ish
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_ishst() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::ISHST>();
+}
+
+// CHECK-LABEL: <test_dmb_ishst>:
+// CHECK-NEXT: dmb ishst
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_nsh() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::NSH>();
+}
+
+// CHECK-LABEL: <test_dmb_nsh>:
+// CHECK-NEXT: dmb nsh
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_nshst() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::NSHST>();
+}
+
+// CHECK-LABEL: <test_dmb_nshst>:
+// CHECK-NEXT: dmb nshst
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_osh() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::OSH>();
+}
+
+// CHECK-LABEL: <test_dmb_osh>:
+// CHECK-NEXT: dmb osh
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_oshst() {
+    ArmCortex::asmDmb<ArmCortex::BarrierOption::OSHST>();
+}
+
+// CHECK-LABEL: <test_dmb_oshst>:
+// CHECK-NEXT: dmb oshst
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dsb_default() {
+    ArmCortex::asmDsb();
+}
+
+// CHECK-LABEL: <test_dsb_default>:
+// CHECK-NEXT: dsb sy
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_dmb_default() {
+    ArmCortex::asmDmb();
+}
+
+// CHECK-LABEL: <test_dmb_default>:
+// CHECK-NEXT: dmb sy
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_isb() {
+    ArmCortex::asmIsb();
+}
+
+// CHECK-LABEL: <test_isb>:
+// CHECK-NEXT: isb sy
+// CHECK-EMPTY:
+
+// Test compilerBarrier() - both stores are kept and no instruction is emitted for the fence
+extern "C" void test_compiler_barrier(uint32_t* flag) {
+    *flag = 1;
+    ArmCortex::compilerBarrier();
+    *flag = 2;
+}
+
+// CHECK-LABEL: <test_compiler_barrier>:
+// CHECK: str
+// CHECK-NOT: dmb
+// CHECK: str
+// CHECK-NOT: dmb
+// CHECK: bx lr
@@ -0,0 +1,68 @@
+#include "armcortex/intrinsics/dsp.hpp"
+
+using namespace ArmCortex::Dsp;
+
+// ============================================================================
+// Constant evaluation (portable implementation on every architecture)
+// ============================================================================
+
+static_assert(ssat<8>(1000) == 127);
+static_assert(ssat<8>(-1000) == -128);
+static_assert(ssat<16>(-5) == -5);
+static_assert(ssat<32>(INT32_MIN) == INT32_MIN);
+static_assert(usat<8>(1000) == 255);
+static_assert(usat<8>(-1000) == 0);
+static_assert(usat<0>(5) == 0);
+static_assert(qadd(INT32_MAX, 1) == INT32_MAX);
+static_assert(qadd(INT32_MIN, -1) == INT32_MIN);
+static_assert(qsub(INT32_MIN, 1) == INT32_MIN);
+static_assert(sadd16(pack16(32767, -1), pack16(1, 1)) == pack16(-32768, 0));
+static_assert(ssub16(pack16(-32768, 5), pack16(1, 7)) == pack16(32767, -2));
+static_assert(qadd16(pack16(32767, -32768), pack16(1, -1)) == pack16(32767, -32768));
+static_assert(qsub16(pack16(-32768, 100), pack16(1, 50)) == pack16(-32768, 50));
+static_assert(uadd8(0xFF01FF01u, 0x01010101u) == 0x00020002u);
+static_assert(usub8(0x00020002u, 0x01010101u) == 0xFF01FF01u);
+static_assert(smuad(pack16(2, 3), pack16(4, 5)) == 23);
+static_assert(smuad(pack16(-32768, -32768), pack16(-32768, -32768)) == INT32_MIN);
+static_assert(smusd(pack16(2, 3), pack16(4, 5)) == 7);
+static_assert(smlad(pack16(2, 3), pack16(4, 5), 100) == 123);
+static_assert(smlsd(pack16(2, 3), pack16(4, 5), 100) == 107);
+static_assert(pkhbt(0x11112222, 0x33334444) == 0x33332222);
+static_assert(pkhbt<16>(0x11112222, 0x33334444) == 0x44442222);
+static_assert(pkhtb(0x11112222, 0x33334444) == 0x11114444);
+static_assert(pkhtb<16>(0x11112222, 0x33334444) == 0x11113333);
+static_assert(Portable::sel(0x11223344u, 0xAABBCCDDu, 0b0101) == 0xAA22CC44u);
+static_assert(Portable::sel(0x01FF0280u, 0x02010301u, Portable::geUsub8(0x01FF0280u, 0x02010301u)) == 0x02FF0380u);
+static_assert(Portable::geUadd8(0xFF01FF01u, 0x01010101u) == 0b1010);
+static_assert(Portable::geSadd16(pack16(-1, 5), pack16(0, -5)) == 0b0011);
+static_assert(Portable::geSsub16(pack16(3, -32768), pack16(1, 1)) == 0b1100);
+
+extern "C" [[gnu::naked]] int32_t test_ssat_compiletime() {
+    constexpr int32_t value = ssat<8>(1000);
+    return value;
+}
+
+// CHECK-LABEL: <test_ssat_compiletime>:
+// CHECK-NEXT: movs r0, #127
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_usat_compiletime() {
+    constexpr uint32_t value = usat<8>(1000);
+    return value;
+}
+
+// CHECK-LABEL: <test_usat_compiletime>:
+// CHECK-NEXT: movs r0, #255
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_smuad_compiletime() {
+    constexpr int32_t value = smuad(pack16(2, 3), pack16(4, 5));
+    return value;
+}
+
+// CHECK-LABEL: <test_smuad_compiletime>:
+// CHECK-NEXT: movs r0, #23
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
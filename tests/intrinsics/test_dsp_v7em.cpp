@@ -0,0 +1,148 @@
+#include "armcortex/intrinsics/dsp.hpp"
+
+extern "C" [[gnu::naked]] int32_t test_qadd(int32_t a, int32_t b) {
+    return ArmCortex::Dsp::qadd(a, b);
+}
+
+// CHECK-LABEL: <test_qadd>:
+// CHECK-NEXT: qadd r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_qsub(int32_t a, int32_t b) {
+    return ArmCortex::Dsp::qsub(a, b);
+}
+
+// CHECK-LABEL: <test_qsub>:
+// CHECK-NEXT: qsub r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_sadd16(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::sadd16(a, b);
+}
+
+// CHECK-LABEL: <test_sadd16>:
+// CHECK-NEXT: sadd16 r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_ssub16(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::ssub16(a, b);
+}
+
+// CHECK-LABEL: <test_ssub16>:
+// CHECK-NEXT: ssub16 r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_qadd16(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::qadd16(a, b);
+}
+
+// CHECK-LABEL: <test_qadd16>:
+// CHECK-NEXT: qadd16 r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_qsub16(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::qsub16(a, b);
+}
+
+// CHECK-LABEL: <test_qsub16>:
+// CHECK-NEXT: qsub16 r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Uint8x4 test_uadd8(ArmCortex::Dsp::Uint8x4 a, ArmCortex::Dsp::Uint8x4 b) {
+    return ArmCortex::Dsp::uadd8(a, b);
+}
+
+// CHECK-LABEL: <test_uadd8>:
+// CHECK-NEXT: uadd8 r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Uint8x4 test_usub8(ArmCortex::Dsp::Uint8x4 a, ArmCortex::Dsp::Uint8x4 b) {
+    return ArmCortex::Dsp::usub8(a, b);
+}
+
+// CHECK-LABEL: <test_usub8>:
+// CHECK-NEXT: usub8 r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_smuad(int32_t a, int32_t b) {
+    return ArmCortex::Dsp::smuad(a, b);
+}
+
+// CHECK-LABEL: <test_smuad>:
+// CHECK-NEXT: smuad r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_smusd(int32_t a, int32_t b) {
+    return ArmCortex::Dsp::smusd(a, b);
+}
+
+// CHECK-LABEL: <test_smusd>:
+// CHECK-NEXT: smusd r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_smlad(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b, int32_t accumulator) {
+    return ArmCortex::Dsp::smlad(a, b, accumulator);
+}
+
+// CHECK-LABEL: <test_smlad>:
+// CHECK-NEXT: smlad r0, r0, r1, r2
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_smlsd(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b, int32_t accumulator) {
+    return ArmCortex::Dsp::smlsd(a, b, accumulator);
+}
+
+// CHECK-LABEL: <test_smlsd>:
+// CHECK-NEXT: smlsd r0, r0, r1, r2
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_pkhbt_0(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::pkhbt<0>(a, b);
+}
+
+// CHECK-LABEL: <test_pkhbt_0>:
+// CHECK-NEXT: pkhbt r0, r0, r1
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_pkhbt_16(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::pkhbt<16>(a, b);
+}
+
+// CHECK-LABEL: <test_pkhbt_16>:
+// CHECK-NEXT: pkhbt r0, r0, r1, lsl #16
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_pkhtb_0(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::pkhtb<0>(a, b);
+}
+
+// CHECK-LABEL: <test_pkhtb_0>:
+// CHECK-NEXT: pkhbt r0, r1, r0
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] ArmCortex::Dsp::Int16x2 test_pkhtb_16(ArmCortex::Dsp::Int16x2 a, ArmCortex::Dsp::Int16x2 b) {
+    return ArmCortex::Dsp::pkhtb<16>(a, b);
+}
+
+// CHECK-LABEL: <test_pkhtb_16>:
+// CHECK-NEXT: pkhtb r0, r0, r1, asr #16
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_sel(uint32_t a, uint32_t b) {
+    return ArmCortex::Dsp::sel(a, b);
+}
+
+// CHECK-LABEL: <test_sel>:
+// CHECK-NEXT: sel r0, r0, r1
+// CHECK-EMPTY:
+
+// Byte-wise unsigned maximum: USUB8 sets GE where a >= b, SEL picks those bytes from a
+extern "C" [[gnu::naked]] uint32_t test_max_u8x4(uint32_t a, uint32_t b) {
+    ArmCortex::Dsp::usub8(a, b);
+    return ArmCortex::Dsp::sel(a, b);
+}
+
+// CHECK-LABEL: <test_max_u8x4>:
+// CHECK-NEXT: usub8 r{{[0-9]}}, r0, r1
+// CHECK-NEXT: sel r0, r0, r1
+// CHECK-EMPTY:
@@ -0,0 +1,35 @@
+#include "armcortex/intrinsics/dsp.hpp"
+
+// SSAT and USAT are part of ARMv7-M, so they are native on Cortex-M3 too.
+
+extern "C" [[gnu::naked]] int32_t test_ssat_8(int32_t value) {
+    return ArmCortex::Dsp::ssat<8>(value);
+}
+
+// CHECK-LABEL: <test_ssat_8>:
+// CHECK-NEXT: ssat r0, #8, r0
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] int32_t test_ssat_16(int32_t value) {
+    return ArmCortex::Dsp::ssat<16>(value);
+}
+
+// CHECK-LABEL: <test_ssat_16>:
+// CHECK-NEXT: ssat r0, #16, r0
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_usat_8(int32_t value) {
+    return ArmCortex::Dsp::usat<8>(value);
+}
+
+// CHECK-LABEL: <test_usat_8>:
+// CHECK-NEXT: usat r0, #8, r0
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_usat_12(int32_t value) {
+    return ArmCortex::Dsp::usat<12>(value);
+}
+
+// CHECK-LABEL: <test_usat_12>:
+// CHECK-NEXT: usat r0, #12, r0
+// CHECK-EMPTY:
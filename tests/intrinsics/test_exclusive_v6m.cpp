@@ -0,0 +1,52 @@
+#include "armcortex/atomic.hpp"
+
+extern "C" [[gnu::naked]] void test_clear_exclusive_monitor() {
+    ArmCortex::clearExclusiveMonitor();
+}
+
+// CHECK-LABEL: <test_clear_exclusive_monitor>:
+// CHECK-EMPTY:
+
+// Test Atomic<uint32_t>::fetchAdd() - PRIMASK is saved, interrupts are masked for the
+// load-add-store only, and the saved PRIMASK is restored (no library calls)
+extern "C" uint32_t test_atomic_fetch_add(ArmCortex::Atomic<uint32_t>& atomic, uint32_t operand) {
+    return atomic.fetchAdd(operand);
+}
+
+// CHECK-LABEL: <test_atomic_fetch_add>:
+// CHECK: mrs [[PRIMASK:r[0-9]+]], PRIMASK
+// CHECK-NEXT: cpsid i
+// CHECK-NEXT: ldr [[OLD:r[0-9]+]], [r0, #0]
+// CHECK-NOT: msr
+// CHECK: adds [[NEW:r[0-9]+]], {{r[0-9]+}}, {{r[0-9]+}}
+// CHECK-NEXT: str [[NEW]], [r0, #0]
+// CHECK-NEXT: msr PRIMASK, [[PRIMASK]]
+// CHECK-NOT: bl
+// CHECK: bx lr
+
+// Test Atomic<uint16_t>::exchange() - masked halfword load and store
+extern "C" uint16_t test_atomic_exchange_u16(ArmCortex::Atomic<uint16_t>& atomic, uint16_t new_value) {
+    return atomic.exchange(new_value);
+}
+
+// CHECK-LABEL: <test_atomic_exchange_u16>:
+// CHECK: mrs [[PRIMASK:r[0-9]+]], PRIMASK
+// CHECK-NEXT: cpsid i
+// CHECK-NEXT: ldrh
+// CHECK-NEXT: strh r1, [r0, #0]
+// CHECK-NEXT: msr PRIMASK, [[PRIMASK]]
+// CHECK-NOT: bl
+// CHECK: bx lr
+
+// Test Atomic<uint32_t>::compareExchange() - comparison happens inside the masked section
+extern "C" bool test_atomic_compare_exchange(ArmCortex::Atomic<uint32_t>& atomic, uint32_t& expected, uint32_t desired) {
+    return atomic.compareExchange(expected, desired);
+}
+
+// CHECK-LABEL: <test_atomic_compare_exchange>:
+// CHECK: mrs [[PRIMASK:r[0-9]+]], PRIMASK
+// CHECK-NEXT: cpsid i
+// CHECK: cmp
+// CHECK: msr PRIMASK, [[PRIMASK]]
+// CHECK-NOT: bl
+// CHECK: bx lr
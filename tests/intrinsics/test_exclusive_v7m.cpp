@@ -0,0 +1,106 @@
+#include "armcortex/atomic.hpp"
+
+extern "C" [[gnu::naked]] uint32_t test_ldrex(volatile uint32_t* addr) {
+    return ArmCortex::asmLdrex(addr);
+}
+
+// CHECK-LABEL: <test_ldrex>:
+// CHECK-NEXT: ldrex r0, [r0]
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint16_t test_ldrexh(volatile uint16_t* addr) {
+    return ArmCortex::asmLdrexh(addr);
+}
+
+// CHECK-LABEL: <test_ldrexh>:
+// CHECK-NEXT: ldrexh r0, [r0]
+// CHECK-NEXT: uxth r0, r0
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint8_t test_ldrexb(volatile uint8_t* addr) {
+    return ArmCortex::asmLdrexb(addr);
+}
+
+// CHECK-LABEL: <test_ldrexb>:
+// CHECK-NEXT: ldrexb r0, [r0]
+// CHECK-NEXT: uxtb r0, r0
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] uint32_t test_strex(uint32_t value, volatile uint32_t* addr) {
+    return ArmCortex::asmStrex(value, addr);
+}
+
+// CHECK-LABEL: <test_strex>:
+// CHECK-NEXT: strex [[STATUS:r[0-9]+]], r0, [r1]
+// CHECK-NEXT: mov r0, [[STATUS]]
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_clrex() {
+    ArmCortex::asmClrex();
+}
+
+// CHECK-LABEL: <test_clrex>:
+// CHECK-NEXT: clrex
+// CHECK-EMPTY:
+
+extern "C" [[gnu::naked]] void test_clear_exclusive_monitor() {
+    ArmCortex::clearExclusiveMonitor();
+}
+
+// CHECK-LABEL: <test_clear_exclusive_monitor>:
+// CHECK-NEXT: clrex
+// CHECK-EMPTY:
+
+// Test Atomic<uint32_t>::fetchAdd() - LDREX/STREX retry loop, no interrupt masking or library calls
+extern "C" uint32_t test_atomic_fetch_add(ArmCortex::Atomic<uint32_t>& atomic, uint32_t operand) {
+    return atomic.fetchAdd(operand);
+}
+
+// CHECK-LABEL: <test_atomic_fetch_add>:
+// CHECK-NOT: cpsid
+// CHECK: ldrex
+// CHECK-NOT: bl
+// CHECK: strex
+// CHECK: {{cbnz|bne}}
+// CHECK-NOT: cpsid
+// CHECK: bx lr
+
+// Test Atomic<uint16_t>::exchange() - halfword exclusive access
+extern "C" uint16_t test_atomic_exchange_u16(ArmCortex::Atomic<uint16_t>& atomic, uint16_t new_value) {
+    return atomic.exchange(new_value);
+}
+
+// CHECK-LABEL: <test_atomic_exchange_u16>:
+// CHECK-NOT: cpsid
+// CHECK: ldrexh
+// CHECK: strexh
+// CHECK: {{cbnz|bne}}
+// CHECK: bx lr
+
+// Test Atomic<uint8_t>::fetchOr() - byte exclusive access
+extern "C" uint8_t test_atomic_fetch_or_u8(ArmCortex::Atomic<uint8_t>& atomic, uint8_t mask) {
+    return atomic.fetchOr(mask);
+}
+
+// CHECK-LABEL: <test_atomic_fetch_or_u8>:
+// CHECK-NOT: cpsid
+// CHECK: ldrexb
+// CHECK: orr
+// CHECK: strexb
+// CHECK: {{cbnz|bne}}
+// CHECK: bx lr
+
+// Test Atomic<uint32_t>::compareExchange() - mismatch path clears the monitor
+extern "C" bool test_atomic_compare_exchange(ArmCortex::Atomic<uint32_t>& atomic, uint32_t& expected, uint32_t desired) {
+    return atomic.compareExchange(expected, desired);
+}
+
+// CHECK-LABEL: <test_atomic_compare_exchange>:
+// CHECK-NOT: cpsid
+// CHECK-DAG: ldrex
+// CHECK-DAG: strex
+// CHECK-DAG: clrex
+// CHECK: bx lr
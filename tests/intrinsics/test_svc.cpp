@@ -0,0 +1,59 @@
+#include "armcortex/svc.hpp"
+
+static void serviceGetValue(ArmCortex::Svc::StackFrame& frame) {
+    frame.r0 = 42;
+}
+
+static void serviceAdd(ArmCortex::Svc::StackFrame& frame) {
+    frame.r0 = frame.r0 + frame.r1;
+}
+
+constexpr ArmCortex::Svc::Handler SERVICES[] = { &serviceGetValue, nullptr, &serviceAdd };
+
+// Test handlerEntry() - stack pointer selected from EXC_RETURN bit 2, then dispatch with LR preserved
+extern "C" [[gnu::naked]] void test_svc_handler_entry() {
+    ArmCortex::Svc::handlerEntry<SERVICES>();
+}
+
+// CHECK-LABEL: <test_svc_handler_entry>:
+// CHECK-NEXT: movs r0, #4
+// CHECK-NEXT: mov r1, lr
+// CHECK-NEXT: tst r0, r1
+// CHECK-NEXT: beq.n
+// CHECK-NEXT: mrs r0, PSP
+// CHECK-NEXT: b.n
+// CHECK-NEXT: mrs r0, MSP
+// CHECK-NEXT: push {r4, lr}
+// CHECK-NEXT: bl
+// CHECK-NEXT: pop {r4, pc}
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+// Test dispatch() - SVC immediate read from the byte at stacked PC - 2, bounds check and table call
+extern "C" void test_svc_dispatch(ArmCortex::Svc::StackFrame* frame) {
+    ArmCortex::Svc::dispatch<SERVICES>(frame);
+}
+
+// CHECK-LABEL: <test_svc_dispatch>:
+// CHECK: ldr r{{[0-9]+}}, [r0, #24]
+// CHECK: ldrb
+// CHECK: cmp r{{[0-9]+}}, #2
+// CHECK: {{blx|bx}} r{{[0-9]+}}
+
+// Test call() - arguments already in R0/R1, nothing but the SVC itself
+extern "C" uint32_t test_svc_call_2(uint32_t a, uint32_t b) {
+    return ArmCortex::Svc::call<2>(a, b);
+}
+
+// CHECK-LABEL: <test_svc_call_2>:
+// CHECK-NEXT: svc 2
+// CHECK-NEXT: bx lr
+
+// Test call() without arguments - result returned in R0
+extern "C" uint32_t test_svc_call_0() {
+    return ArmCortex::Svc::call<0>();
+}
+
+// CHECK-LABEL: <test_svc_call_0>:
+// CHECK-NEXT: svc 0
+// CHECK-NEXT: bx lr
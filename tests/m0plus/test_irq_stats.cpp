@@ -0,0 +1,49 @@
+#include "armcortex/m0plus/irq_stats.hpp"
+
+static_assert(sizeof(ArmCortex::IrqStats::Entry) == 16);
+
+ArmCortex::IrqStats::Table<> test_stats;
+
+extern "C" void measured_handler_body();
+
+// Test measured() - timestamps around the handler call, then a plain table update indexed by IPSR
+extern "C" void test_irq_stats_measured() {
+    ArmCortex::IrqStats::measured<test_stats, &measured_handler_body>();
+}
+
+// CHECK-LABEL: <test_irq_stats_measured>:
+// CHECK: {{bl }}
+// CHECK: mrs {{r[0-9]+}}, IPSR
+// CHECK-NOT: {{ldrex|strex|cpsid}}
+// CHECK: pop
+
+// Test Table::update() - no atomics and no interrupt masking on the hot path
+extern "C" void test_irq_stats_update(uint32_t ticks) {
+    test_stats.update(static_cast<uint16_t>(ArmCortex::ExceptionNumber::SYS_TICK), ticks);
+}
+
+// CHECK-LABEL: <test_irq_stats_update>:
+// CHECK-NOT: {{ldrex|strex|cpsid|bl }}
+// CHECK: bx lr
+
+ArmCortex::IrqStats::Table<16> test_small_stats;
+
+// Test Table::update() on a table smaller than NUM_OF_EXCEPTIONS - exception number checked before indexing
+extern "C" void test_irq_stats_update_bounded(uint16_t exception, uint32_t ticks) {
+    test_small_stats.update(exception, ticks);
+}
+
+// CHECK-LABEL: <test_irq_stats_update_bounded>:
+// CHECK: cmp {{r[0-9]+}}, #15
+// CHECK-NOT: {{ldrex|strex|cpsid|bl }}
+// CHECK: {{bx lr|pop .*pc}}
+
+// Test Table::snapshot() - each entry copied inside its own PRIMASK section
+extern "C" void test_irq_stats_snapshot(ArmCortex::IrqStats::Entry (&snapshot)[ArmCortex::IrqStats::NUM_OF_EXCEPTIONS]) {
+    test_stats.snapshot(snapshot, true);
+}
+
+// CHECK-LABEL: <test_irq_stats_snapshot>:
+// CHECK: mrs {{r[0-9]+}}, PRIMASK
+// CHECK: cpsid i
+// CHECK: msr PRIMASK, {{r[0-9]+}}
@@ -202,3 +202,36 @@ extern "C" [[gnu::naked]] void test_set_control() {
 // MAXSPEED-CHECK-NEXT: nop
 
 // CHECK-EMPTY:
+
+// Test switchToPsp() - thread mode keeps the stack, MSP moves to the handler stack last
+extern "C" void test_switch_to_psp(uint32_t main_stack_top) {
+    ArmCortex::switchToPsp(main_stack_top);
+}
+
+// CHECK-LABEL: <test_switch_to_psp>:
+// CHECK-NEXT: mrs [[SP:r[0-7]]], MSP
+// CHECK-NEXT: msr PSP, [[SP]]
+// CHECK-NEXT: mrs [[SP]], CONTROL
+// CHECK-NEXT: movs [[BIT:r[0-7]]], #2
+// CHECK-NEXT: orrs [[SP]], [[BIT]]
+// CHECK-NEXT: msr CONTROL, [[SP]]
+// CHECK-NEXT: isb sy
+// CHECK-NEXT: msr MSP, {{r[0-7]}}
+// CHECK-NEXT: bx lr
+
+extern "C" void unprivileged_entry();
+
+// Test enterUnprivilegedThread()
+extern "C" void test_enter_unprivileged_thread(uint32_t stack_top) {
+    ArmCortex::enterUnprivilegedThread(stack_top, unprivileged_entry);
+}
+
+// CHECK-LABEL: <test_enter_unprivileged_thread>:
+// CHECK: msr PSP, {{r[0-7]}}
+// CHECK-NEXT: mrs [[CTRL:r[0-7]]], CONTROL
+// CHECK-NEXT: movs [[BITS:r[0-7]]], #3
+// CHECK-NEXT: orrs [[CTRL]], [[BITS]]
+// CHECK-NEXT: msr CONTROL, [[CTRL]]
+// CHECK-NEXT: isb sy
+// CHECK-NEXT: blx {{r[0-7]}}
+// CHECK-NEXT: b.n
@@ -0,0 +1,112 @@
+#include "armcortex/m1/scb.hpp"
+#include "armcortex/m1/systick.hpp"
+
+using ArmCortex::Scb::AIRCR;
+using ArmCortex::Scb::ICSR;
+using ArmCortex::Scb::SCR;
+
+static_assert(SCR::SLEEPDEEP_FIELD.MASK == 0x00000004u);
+static_assert(AIRCR::SYSRESETREQ_FIELD.MASK == 0x00000004u);
+static_assert(ICSR::PENDSVSET_FIELD(1).bits == 0x10000000u);
+static_assert(SCR::SLEEPDEEP_FIELD.get(0x00000014u) == 1u);
+
+using namespace ArmCortex;
+
+// Every field descriptor covers exactly the bits of its Bits member
+static_assert(matchesBitfield(Scb::CPUID::REVISION_FIELD, [](auto& bits, uint32_t ones) { bits.REVISION = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::PARTNO_FIELD, [](auto& bits, uint32_t ones) { bits.PARTNO = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::ARCHITECTURE_FIELD, [](auto& bits, uint32_t ones) { bits.ARCHITECTURE = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::VARIANT_FIELD, [](auto& bits, uint32_t ones) { bits.VARIANT = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::IMPLEMENTER_FIELD, [](auto& bits, uint32_t ones) { bits.IMPLEMENTER = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::VECTACTIVE_FIELD, [](auto& bits, uint32_t ones) { bits.VECTACTIVE = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::VECTPENDING_FIELD, [](auto& bits, uint32_t ones) { bits.VECTPENDING = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::ISRPENDING_FIELD, [](auto& bits, uint32_t ones) { bits.ISRPENDING = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::ISRPREEMPT_FIELD, [](auto& bits, uint32_t ones) { bits.ISRPREEMPT = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSTCLR_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSTCLR = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSTSET_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSTSET = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSVCLR_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSVCLR = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSVSET_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSVSET = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::NMIPENDSET_FIELD, [](auto& bits, uint32_t ones) { bits.NMIPENDSET = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::VECTCLRACTIVE_FIELD, [](auto& bits, uint32_t ones) { bits.VECTCLRACTIVE = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::SYSRESETREQ_FIELD, [](auto& bits, uint32_t ones) { bits.SYSRESETREQ = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::ENDIANNESS_FIELD, [](auto& bits, uint32_t ones) { bits.ENDIANNESS = ones; }));
+static_assert(matchesBitfield(Scb::SCR::SLEEPONEXIT_FIELD, [](auto& bits, uint32_t ones) { bits.SLEEPONEXIT = ones; }));
+static_assert(matchesBitfield(Scb::SCR::SLEEPDEEP_FIELD, [](auto& bits, uint32_t ones) { bits.SLEEPDEEP = ones; }));
+static_assert(matchesBitfield(Scb::SCR::SEVONPEND_FIELD, [](auto& bits, uint32_t ones) { bits.SEVONPEND = ones; }));
+static_assert(matchesBitfield(Scb::CCR::UNALIGN_TRP_FIELD, [](auto& bits, uint32_t ones) { bits.UNALIGN_TRP = ones; }));
+static_assert(matchesBitfield(Scb::CCR::STKALIGN_FIELD, [](auto& bits, uint32_t ones) { bits.STKALIGN = ones; }));
+static_assert(matchesBitfield(Scb::SHPR2::PRI_11_FIELD, [](auto& bits, uint32_t ones) { bits.PRI_11 = ones; }));
+static_assert(matchesBitfield(Scb::SHPR3::PRI_14_FIELD, [](auto& bits, uint32_t ones) { bits.PRI_14 = ones; }));
+static_assert(matchesBitfield(Scb::SHPR3::PRI_15_FIELD, [](auto& bits, uint32_t ones) { bits.PRI_15 = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::SVCALLPENDED_FIELD, [](auto& bits, uint32_t ones) { bits.SVCALLPENDED = ones; }));
+
+static_assert(matchesBitfield(SysTick::CTRL::ENABLE_FIELD, [](auto& bits, uint32_t ones) { bits.ENABLE = ones; }));
+static_assert(matchesBitfield(SysTick::CTRL::TICKINT_FIELD, [](auto& bits, uint32_t ones) { bits.TICKINT = ones; }));
+static_assert(matchesBitfield(SysTick::CTRL::CLKSOURCE_FIELD, [](auto& bits, uint32_t ones) { bits.CLKSOURCE = ones; }));
+static_assert(matchesBitfield(SysTick::CTRL::COUNTFLAG_FIELD, [](auto& bits, uint32_t ones) { bits.COUNTFLAG = ones; }));
+static_assert(matchesBitfield(SysTick::CALIB::TENMS_FIELD, [](auto& bits, uint32_t ones) { bits.TENMS = ones; }));
+static_assert(matchesBitfield(SysTick::CALIB::SKEW_FIELD, [](auto& bits, uint32_t ones) { bits.SKEW = ones; }));
+static_assert(matchesBitfield(SysTick::CALIB::NOREF_FIELD, [](auto& bits, uint32_t ones) { bits.NOREF = ones; }));
+
+// Test modify() - three SCR fields updated with a single load and store
+extern "C" void test_modify_scr() {
+    ArmCortex::modify<SCR>(ArmCortex::SCB->SCR, SCR::SLEEPDEEP_FIELD(1), SCR::SLEEPONEXIT_FIELD(1), SCR::SEVONPEND_FIELD(0));
+}
+
+// CHECK-LABEL: <test_modify_scr>:
+// CHECK: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK-NOT: str
+// CHECK: str r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK-NOT: {{ldr|str}} r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK: bx lr
+
+// Reference: the same update as three single-field read-modify-write sequences
+extern "C" void test_separate_bitfield_updates_scr() {
+    SCR sleep_deep { ArmCortex::SCB->SCR };
+    sleep_deep.bits.SLEEPDEEP = 1;
+    ArmCortex::SCB->SCR = sleep_deep.value;
+
+    SCR sleep_on_exit { ArmCortex::SCB->SCR };
+    sleep_on_exit.bits.SLEEPONEXIT = 1;
+    ArmCortex::SCB->SCR = sleep_on_exit.value;
+
+    SCR sev_on_pend { ArmCortex::SCB->SCR };
+    sev_on_pend.bits.SEVONPEND = 0;
+    ArmCortex::SCB->SCR = sev_on_pend.value;
+}
+
+// CHECK-LABEL: <test_separate_bitfield_updates_scr>:
+// CHECK-COUNT-3: str r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK: bx lr
+
+// Test modify() on AIRCR - the VECTKEY is inserted automatically
+extern "C" void test_modify_aircr_vectclractive() {
+    ArmCortex::modify<AIRCR>(ArmCortex::SCB->AIRCR, AIRCR::VECTCLRACTIVE_FIELD(0));
+}
+
+// CHECK-LABEL: <test_modify_aircr_vectclractive>:
+// CHECK: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #12]
+// CHECK: str r{{[0-9]+}}, [r{{[0-9]+}}, #12]
+// CHECK-NOT: {{ldr|str}} r{{[0-9]+}}, [r{{[0-9]+}}, #12]
+// CHECK: bx lr
+
+// Test write() on ICSR - W1S bit written without reading the register
+extern "C" void test_write_icsr_pendsvset() {
+    ArmCortex::write<ICSR>(ArmCortex::SCB->ICSR, ICSR::PENDSVSET_FIELD(1));
+}
+
+// CHECK-LABEL: <test_write_icsr_pendsvset>:
+// CHECK-NOT: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #4]
+// CHECK: str r{{[0-9]+}}, [r{{[0-9]+}}, #4]
+// CHECK-NOT: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #4]
+// CHECK: bx lr
+
+// Test read() - single field extract with a shift pair
+extern "C" uint32_t test_read_scr_sleepdeep() {
+    return ArmCortex::read<SCR>(ArmCortex::SCB->SCR, SCR::SLEEPDEEP_FIELD);
+}
+
+// CHECK-LABEL: <test_read_scr_sleepdeep>:
+// CHECK: ldr r0, [r{{[0-9]+}}, #16]
+// CHECK: lsrs r0, r0, #
+// CHECK: bx lr
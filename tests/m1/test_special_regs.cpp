@@ -202,3 +202,19 @@ extern "C" [[gnu::naked]] void test_set_control() {
 // MAXSPEED-CHECK-NEXT: nop
 
 // CHECK-EMPTY:
+
+// Test switchToPsp() - thread mode keeps the stack, MSP moves to the handler stack last
+extern "C" void test_switch_to_psp(uint32_t main_stack_top) {
+    ArmCortex::switchToPsp(main_stack_top);
+}
+
+// CHECK-LABEL: <test_switch_to_psp>:
+// CHECK-NEXT: mrs [[SP:r[0-7]]], MSP
+// CHECK-NEXT: msr PSP, [[SP]]
+// CHECK-NEXT: mrs [[SP]], CONTROL
+// CHECK-NEXT: movs [[BIT:r[0-7]]], #2
+// CHECK-NEXT: orrs [[SP]], [[BIT]]
+// CHECK-NEXT: msr CONTROL, [[SP]]
+// CHECK-NEXT: isb sy
+// CHECK-NEXT: msr MSP, {{r[0-7]}}
+// CHECK-NEXT: bx lr
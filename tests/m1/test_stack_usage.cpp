@@ -0,0 +1,48 @@
+#include "armcortex/m1/stack_usage.hpp"
+
+static_assert(ArmCortex::StackUsage::Region{nullptr, nullptr}.size() == 0);
+
+// Test paintMainStack() - reads MSP, fills with volatile stores, no memset call
+extern "C" void test_paint_main_stack(ArmCortex::StackUsage::Region region) {
+    ArmCortex::StackUsage::paintMainStack(region);
+}
+
+// CHECK-LABEL: <test_paint_main_stack>:
+// CHECK: mrs {{r[0-9]+}}, MSP
+// CHECK-NOT: {{bl }}
+// CHECK: str
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test mainStackHighWaterMark() - reads MSP, word scan, no library calls
+extern "C" uint32_t test_main_stack_high_water_mark(ArmCortex::StackUsage::Region region) {
+    return ArmCortex::StackUsage::mainStackHighWaterMark(region);
+}
+
+// CHECK-LABEL: <test_main_stack_high_water_mark>:
+// CHECK: mrs {{r[0-9]+}}, MSP
+// CHECK-NOT: {{bl }}
+// CHECK: ldr
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test processStackHighWaterMark() - reads PSP
+extern "C" uint32_t test_process_stack_high_water_mark(ArmCortex::StackUsage::Region region) {
+    return ArmCortex::StackUsage::processStackHighWaterMark(region);
+}
+
+// CHECK-LABEL: <test_process_stack_high_water_mark>:
+// CHECK: mrs {{r[0-9]+}}, PSP
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test Sampler::sample() on the process stack - reads PSP, no library calls
+extern "C" uint32_t test_sampler_sample(ArmCortex::StackUsage::Sampler& sampler) {
+    return sampler.sample();
+}
+
+// CHECK-LABEL: <test_sampler_sample>:
+// CHECK-NOT: {{bl }}
+// CHECK: mrs {{r[0-9]+}}, PSP
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
@@ -238,3 +238,13 @@ extern "C" [[gnu::naked]] void test_write_ipr() {
 // MAXSPEED-CHECK-NEXT: .word 0xe000e100
 
 // CHECK-EMPTY:
+
+// Test disableAllIrqs() - loop bound read from ICTR, ICER written with all ones
+extern "C" void test_disable_all_irqs() {
+    ArmCortex::Nvic::disableAllIrqs();
+}
+
+// CHECK-LABEL: <test_disable_all_irqs>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: mov.w {{r[0-9]+}}, #4294967295
+// CHECK: bx lr
@@ -0,0 +1,139 @@
+#include "armcortex/m33/mpu.hpp"
+#include <cstddef>
+
+static_assert(offsetof(ArmCortex::Mpu::Registers, RLAR) == 0x10);
+static_assert(offsetof(ArmCortex::Mpu::Registers, RLAR_A3) == 0x28);
+static_assert(offsetof(ArmCortex::Mpu::Registers, MAIR0) == 0x30);
+static_assert(offsetof(ArmCortex::Mpu::Registers, MAIR1) == 0x34);
+
+// Test reading TYPE register
+extern "C" [[gnu::naked]] auto test_read_type() {
+    return ArmCortex::Mpu::TYPE(ArmCortex::MPU->TYPE);
+}
+
+// CHECK-LABEL: <test_read_type>:
+// CHECK-NEXT: ldr r3, [pc, #4]
+// CHECK-NEXT: ldr.w r0, [r3, #144]
+// CHECK-NEXT: nop
+// CHECK-NEXT: .word 0xe000ed00
+// CHECK-EMPTY:
+
+// Test reading CTRL register
+extern "C" [[gnu::naked]] auto test_read_ctrl() {
+    return ArmCortex::Mpu::CTRL(ArmCortex::MPU->CTRL);
+}
+
+// CHECK-LABEL: <test_read_ctrl>:
+// CHECK-NEXT: ldr r3, [pc, #4]
+// CHECK-NEXT: ldr.w r0, [r3, #148]
+// CHECK-NEXT: nop
+// CHECK-NEXT: .word 0xe000ed00
+// CHECK-EMPTY:
+
+// Test writing CTRL register
+extern "C" [[gnu::naked]] void test_write_ctrl() {
+    ArmCortex::Mpu::CTRL ctrl;
+    ctrl.bits.ENABLE = 1;
+    ctrl.bits.PRIVDEFENA = 1;
+    ArmCortex::MPU->CTRL = ctrl.value;
+}
+
+// CHECK-LABEL: <test_write_ctrl>:
+// CHECK: movs r2, #5
+// CHECK: str.w r2, [r3, #148]
+// CHECK: .word 0xe000ed00
+// CHECK-EMPTY:
+
+// Test reading RBAR register
+extern "C" [[gnu::naked]] auto test_read_rbar() {
+    return ArmCortex::Mpu::RBAR(ArmCortex::MPU->RBAR);
+}
+
+// CHECK-LABEL: <test_read_rbar>:
+// CHECK-NEXT: ldr r3, [pc, #4]
+// CHECK-NEXT: ldr.w r0, [r3, #156]
+// CHECK-NEXT: nop
+// CHECK-NEXT: .word 0xe000ed00
+// CHECK-EMPTY:
+
+// Test reading RLAR register
+extern "C" [[gnu::naked]] auto test_read_rlar() {
+    return ArmCortex::Mpu::RLAR(ArmCortex::MPU->RLAR);
+}
+
+// CHECK-LABEL: <test_read_rlar>:
+// CHECK-NEXT: ldr r3, [pc, #4]
+// CHECK-NEXT: ldr.w r0, [r3, #160]
+// CHECK-NEXT: nop
+// CHECK-NEXT: .word 0xe000ed00
+// CHECK-EMPTY:
+
+// Test writing RLAR register
+extern "C" [[gnu::naked]] void test_write_rlar() {
+    ArmCortex::Mpu::RLAR rlar;
+    rlar.bits.EN = 1;
+    rlar.bits.ATTRINDX = 2;
+    rlar.bits.LIMIT = 0x2000FFFF >> 5;
+    ArmCortex::MPU->RLAR = rlar.value;
+}
+
+// CHECK-LABEL: <test_write_rlar>:
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #160]
+// CHECK: .word 0x2000ffe5
+
+// Test reading MAIR0 register
+extern "C" [[gnu::naked]] uint32_t test_read_mair0() {
+    return ArmCortex::MPU->MAIR0;
+}
+
+// CHECK-LABEL: <test_read_mair0>:
+// CHECK-NEXT: ldr r3, [pc, #4]
+// CHECK-NEXT: ldr.w r0, [r3, #192]
+// CHECK-NEXT: nop
+// CHECK-NEXT: .word 0xe000ed00
+// CHECK-EMPTY:
+
+// Test setMemoryAttributes() - index 1 lives in MAIR0 bits [15:8]
+extern "C" [[gnu::naked]] void test_set_memory_attributes() {
+    ArmCortex::Mpu::setMemoryAttributes(1, ArmCortex::Mpu::MemoryAttributes::NORMAL_WRITE_BACK);
+}
+
+// CHECK-LABEL: <test_set_memory_attributes>:
+// CHECK: ldr.w {{r[0-9]+}}, [{{r[0-9]+}}, #192]
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #192]
+
+// Test setMemoryAttributes() - index 5 lives in MAIR1 bits [15:8]
+extern "C" [[gnu::naked]] void test_set_memory_attributes_high() {
+    ArmCortex::Mpu::setMemoryAttributes(5, ArmCortex::Mpu::MemoryAttributes::DEVICE_NGNRE);
+}
+
+// CHECK-LABEL: <test_set_memory_attributes_high>:
+// CHECK: ldr.w {{r[0-9]+}}, [{{r[0-9]+}}, #196]
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #196]
+
+// Test configureRegion() - RNR, RBAR and RLAR are written in order, then barriers
+extern "C" [[gnu::naked]] void test_configure_region() {
+    ArmCortex::Mpu::RBAR attributes;
+    attributes.bits.XN = 1;
+    attributes.bits.AP = static_cast<uint32_t>(ArmCortex::Mpu::RBAR::AP::RW);
+    ArmCortex::Mpu::configureRegion(2, 0x20000000, 0x2000FFFF, attributes, 1);
+}
+
+// CHECK-LABEL: <test_configure_region>:
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #152]
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #156]
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #160]
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+
+// Test disableRegion()
+extern "C" [[gnu::naked]] void test_disable_region() {
+    ArmCortex::Mpu::disableRegion(2);
+}
+
+// CHECK-LABEL: <test_disable_region>:
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #152]
+// CHECK: bic{{.*}}#1
+// CHECK: str.w {{r[0-9]+}}, [{{r[0-9]+}}, #160]
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
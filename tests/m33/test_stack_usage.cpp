@@ -0,0 +1,70 @@
+#include "armcortex/m33/stack_usage.hpp"
+
+static_assert(ArmCortex::StackUsage::Region{nullptr, nullptr}.size() == 0);
+
+// Test paintMainStack() - reads MSP, fills with volatile stores, no memset call
+extern "C" void test_paint_main_stack(ArmCortex::StackUsage::Region region) {
+    ArmCortex::StackUsage::paintMainStack(region);
+}
+
+// CHECK-LABEL: <test_paint_main_stack>:
+// CHECK: mrs {{r[0-9]+}}, MSP
+// CHECK-NOT: {{bl }}
+// CHECK: str
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test mainStackHighWaterMark() - reads MSP, word scan, no library calls
+extern "C" uint32_t test_main_stack_high_water_mark(ArmCortex::StackUsage::Region region) {
+    return ArmCortex::StackUsage::mainStackHighWaterMark(region);
+}
+
+// CHECK-LABEL: <test_main_stack_high_water_mark>:
+// CHECK: mrs {{r[0-9]+}}, MSP
+// CHECK-NOT: {{bl }}
+// CHECK: ldr
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test processStackHighWaterMark() - reads PSP
+extern "C" uint32_t test_process_stack_high_water_mark(ArmCortex::StackUsage::Region region) {
+    return ArmCortex::StackUsage::processStackHighWaterMark(region);
+}
+
+// CHECK-LABEL: <test_process_stack_high_water_mark>:
+// CHECK: mrs {{r[0-9]+}}, PSP
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test Sampler::sample() on the process stack - reads PSP, no library calls
+extern "C" uint32_t test_sampler_sample(ArmCortex::StackUsage::Sampler& sampler) {
+    return sampler.sample();
+}
+
+// CHECK-LABEL: <test_sampler_sample>:
+// CHECK-NOT: {{bl }}
+// CHECK: mrs {{r[0-9]+}}, PSP
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test protectMainStack() - a single MSPLIM write, no stack painting
+extern "C" void test_protect_main_stack(ArmCortex::StackUsage::Region region) {
+    ArmCortex::StackUsage::protectMainStack(region);
+}
+
+// CHECK-LABEL: <test_protect_main_stack>:
+// CHECK-NOT: {{bl }}
+// CHECK: msr MSPLIM, {{r[0-9]+}}
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test protectProcessStack() - a single PSPLIM write
+extern "C" void test_protect_process_stack(ArmCortex::StackUsage::Region region) {
+    ArmCortex::StackUsage::protectProcessStack(region);
+}
+
+// CHECK-LABEL: <test_protect_process_stack>:
+// CHECK-NOT: {{bl }}
+// CHECK: msr PSPLIM, {{r[0-9]+}}
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
@@ -0,0 +1,54 @@
+#include "armcortex/m4/bitband.hpp"
+
+static_assert(ArmCortex::bitBandAlias<0x20000000u, 0>() == 0x22000000u);
+static_assert(ArmCortex::bitBandAlias<0x20000000u, 31>() == 0x2200007Cu);
+static_assert(ArmCortex::bitBandAlias<0x200FFFFCu, 31>() == 0x23FFFFFCu);
+static_assert(ArmCortex::bitBandAlias<0x40021018u, 2>() == 0x42420308u);
+static_assert(ArmCortex::bitBandRef<0x40000000u, 8>().aliasAddress() == 0x42000020u);
+static_assert(!ArmCortex::BitBand::isInRegion(0x20100000u));
+static_assert(!ArmCortex::BitBand::isInRegion(0x60000000u));
+
+// Test setBit() through a compile-time bit-band reference - single store, no read
+extern "C" void test_bitband_set_peripheral() {
+    ArmCortex::setBit(ArmCortex::bitBandRef<0x40021018u, 2>());
+}
+
+// CHECK-LABEL: <test_bitband_set_peripheral>:
+// CHECK-NOT: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #0]
+// CHECK: movs [[ONE:r[0-9]+]], #1
+// CHECK-NOT: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #0]
+// CHECK: str{{.*}}, [r{{[0-9]+}}, #0]
+// CHECK-NOT: cpsid
+// CHECK: .word 0x42420308
+
+// Test clearBit() through a compile-time bit-band reference - single store of 0
+extern "C" void test_bitband_clear_peripheral() {
+    ArmCortex::clearBit(ArmCortex::bitBandRef<0x40021018u, 2>());
+}
+
+// CHECK-LABEL: <test_bitband_clear_peripheral>:
+// CHECK-NOT: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #0]
+// CHECK: movs [[ZERO:r[0-9]+]], #0
+// CHECK: str{{.*}}, [r{{[0-9]+}}, #0]
+// CHECK: .word 0x42420308
+
+// Test isBitSet() through a compile-time bit-band reference - single load
+extern "C" bool test_bitband_is_set_peripheral() {
+    return ArmCortex::isBitSet(ArmCortex::bitBandRef<0x40021018u, 2>());
+}
+
+// CHECK-LABEL: <test_bitband_is_set_peripheral>:
+// CHECK: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #0]
+// CHECK: .word 0x42420308
+
+// Test setBit() on an SRAM word - alias computed at run time, single store
+extern "C" void test_bitband_set_sram(volatile uint32_t& flags) {
+    ArmCortex::setBit(ArmCortex::BitBandRef(flags, 5));
+}
+
+// CHECK-LABEL: <test_bitband_set_sram>:
+// CHECK-NOT: cpsid
+// CHECK-NOT: ldr r{{[0-9]+}}, [r0, #0]
+// CHECK: str
+// CHECK-NOT: str
+// CHECK: bx lr
@@ -0,0 +1,162 @@
+#include "armcortex/m4/fpu.hpp"
+
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::LSPACT_FIELD, [](auto& bits, uint32_t ones) { bits.LSPACT = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::USER_FIELD, [](auto& bits, uint32_t ones) { bits.USER = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::THREAD_FIELD, [](auto& bits, uint32_t ones) { bits.THREAD = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::HFRDY_FIELD, [](auto& bits, uint32_t ones) { bits.HFRDY = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::MMRDY_FIELD, [](auto& bits, uint32_t ones) { bits.MMRDY = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::BFRDY_FIELD, [](auto& bits, uint32_t ones) { bits.BFRDY = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::MONRDY_FIELD, [](auto& bits, uint32_t ones) { bits.MONRDY = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::LSPEN_FIELD, [](auto& bits, uint32_t ones) { bits.LSPEN = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCCR::ASPEN_FIELD, [](auto& bits, uint32_t ones) { bits.ASPEN = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPCAR::ADDRESS_FIELD, [](auto& bits, uint32_t ones) { bits.ADDRESS = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPDSCR::RMODE_FIELD, [](auto& bits, uint32_t ones) { bits.RMODE = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPDSCR::FZ_FIELD, [](auto& bits, uint32_t ones) { bits.FZ = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPDSCR::DN_FIELD, [](auto& bits, uint32_t ones) { bits.DN = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::FPDSCR::AHP_FIELD, [](auto& bits, uint32_t ones) { bits.AHP = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::A_SIMD_REGISTERS_FIELD, [](auto& bits, uint32_t ones) { bits.A_SIMD_REGISTERS = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::SINGLE_PRECISION_FIELD, [](auto& bits, uint32_t ones) { bits.SINGLE_PRECISION = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::DOUBLE_PRECISION_FIELD, [](auto& bits, uint32_t ones) { bits.DOUBLE_PRECISION = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::VFP_EXCEPTION_TRAPPING_FIELD, [](auto& bits, uint32_t ones) { bits.VFP_EXCEPTION_TRAPPING = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::DIVIDE_FIELD, [](auto& bits, uint32_t ones) { bits.DIVIDE = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::SQUARE_ROOT_FIELD, [](auto& bits, uint32_t ones) { bits.SQUARE_ROOT = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::SHORT_VECTORS_FIELD, [](auto& bits, uint32_t ones) { bits.SHORT_VECTORS = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR0::VFP_ROUNDING_MODES_FIELD, [](auto& bits, uint32_t ones) { bits.VFP_ROUNDING_MODES = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR1::FTZ_MODE_FIELD, [](auto& bits, uint32_t ones) { bits.FTZ_MODE = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR1::D_NAN_MODE_FIELD, [](auto& bits, uint32_t ones) { bits.D_NAN_MODE = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR1::FP_HPFP_FIELD, [](auto& bits, uint32_t ones) { bits.FP_HPFP = ones; }));
+static_assert(ArmCortex::matchesBitfield(ArmCortex::Fpu::MVFR1::FP_FUSED_MAC_FIELD, [](auto& bits, uint32_t ones) { bits.FP_FUSED_MAC = ones; }));
+
+// Test reading FPCCR register
+extern "C" [[gnu::naked]] auto test_read_fpccr() {
+    return ArmCortex::Fpu::FPCCR(ArmCortex::FPU->FPCCR);
+}
+
+// CHECK-LABEL: <test_read_fpccr>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #0]
+// CHECK-NEXT: .word 0xe000ef34
+// CHECK-EMPTY:
+
+// Test reading FPCAR register
+extern "C" [[gnu::naked]] auto test_read_fpcar() {
+    return ArmCortex::Fpu::FPCAR(ArmCortex::FPU->FPCAR);
+}
+
+// CHECK-LABEL: <test_read_fpcar>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #4]
+// CHECK-NEXT: .word 0xe000ef34
+// CHECK-EMPTY:
+
+// Test reading FPDSCR register
+extern "C" [[gnu::naked]] auto test_read_fpdscr() {
+    return ArmCortex::Fpu::FPDSCR(ArmCortex::FPU->FPDSCR);
+}
+
+// CHECK-LABEL: <test_read_fpdscr>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #8]
+// CHECK-NEXT: .word 0xe000ef34
+// CHECK-EMPTY:
+
+// Test reading MVFR0 register
+extern "C" [[gnu::naked]] auto test_read_mvfr0() {
+    return ArmCortex::Fpu::MVFR0(ArmCortex::FPU->MVFR0);
+}
+
+// CHECK-LABEL: <test_read_mvfr0>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #12]
+// CHECK-NEXT: .word 0xe000ef34
+// CHECK-EMPTY:
+
+// Test reading MVFR1 register
+extern "C" [[gnu::naked]] auto test_read_mvfr1() {
+    return ArmCortex::Fpu::MVFR1(ArmCortex::FPU->MVFR1);
+}
+
+// CHECK-LABEL: <test_read_mvfr1>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #16]
+// CHECK-NEXT: .word 0xe000ef34
+// CHECK-EMPTY:
+
+// Test getFpscrReg()
+extern "C" [[gnu::naked]] ArmCortex::FPSCR test_get_fpscr() {
+    return ArmCortex::getFpscrReg();
+}
+
+// CHECK-LABEL: <test_get_fpscr>:
+// CHECK-NEXT: vmrs r0, fpscr
+// CHECK-EMPTY:
+
+// Test setFpscrReg()
+extern "C" [[gnu::naked]] void test_set_fpscr(ArmCortex::FPSCR fpscr) {
+    ArmCortex::setFpscrReg(fpscr);
+}
+
+// CHECK-LABEL: <test_set_fpscr>:
+// CHECK-NEXT: vmsr fpscr, r0
+// CHECK-EMPTY:
+
+// =============================================================================
+// FPU enable and context preservation
+// =============================================================================
+
+// Test enable() with lazy state preservation (ASPEN = 1, LSPEN = 1)
+extern "C" void test_enable_lazy() {
+    ArmCortex::Fpu::enable(ArmCortex::Fpu::StatePreservation::LAZY);
+}
+
+// CHECK-LABEL: <test_enable_lazy>:
+// CHECK: ldr r{{[0-9]}}, [r{{[0-9]}}, #0]
+// CHECK: str r{{[0-9]}}, [r{{[0-9]}}, #0]
+// CHECK: ldr{{.*}}
+// CHECK: str{{.*}}
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: .word 0xe000ef34
+
+// Test enable() without automatic state preservation (ASPEN = 0, LSPEN = 0)
+extern "C" void test_enable_no_preservation() {
+    ArmCortex::Fpu::enable(ArmCortex::Fpu::StatePreservation::NONE);
+}
+
+// CHECK-LABEL: <test_enable_no_preservation>:
+// CHECK: ldr r{{[0-9]}}, [r{{[0-9]}}, #0]
+// CHECK: str r{{[0-9]}}, [r{{[0-9]}}, #0]
+// CHECK: ldr{{.*}}
+// CHECK: str{{.*}}
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: .word 0xe000ef34
+
+// =============================================================================
+// Arithmetic modes
+// =============================================================================
+
+// Test setDefaultMode() - FPDSCR gets FZ and DN, other fields are preserved
+extern "C" void test_set_default_fast_math_mode() {
+    ArmCortex::Fpu::setDefaultMode(ArmCortex::Fpu::FAST_MATH_MODE);
+}
+
+// CHECK-LABEL: <test_set_default_fast_math_mode>:
+// CHECK: ldr r{{[0-9]}}, [r{{[0-9]}}, #8]
+// CHECK: str r{{[0-9]}}, [r{{[0-9]}}, #8]
+// CHECK: .word 0xe000ef34
+
+// Test ScopedMode - the multiply runs between the two FPSCR writes
+extern "C" void test_scoped_fast_math_mode(float* data) {
+    ArmCortex::Fpu::ScopedMode mode(ArmCortex::Fpu::FAST_MATH_MODE);
+    data[0] = data[0] * data[1];
+}
+
+// CHECK-LABEL: <test_scoped_fast_math_mode>:
+// CHECK: vmrs [[SAVED:r[0-9]+]], fpscr
+// CHECK: vmsr fpscr, r{{[0-9]+}}
+// CHECK: vmul.f32
+// CHECK: vstr
+// CHECK: vmrs r{{[0-9]+}}, fpscr
+// CHECK: vmsr fpscr, r{{[0-9]+}}
+// CHECK: bx lr
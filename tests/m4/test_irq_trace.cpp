@@ -0,0 +1,37 @@
+#include "armcortex/m4/irq_trace.hpp"
+
+static_assert(sizeof(ArmCortex::IrqTrace::Event) == 8);
+static_assert(sizeof(ArmCortex::IrqTrace::Buffer<4>) == 16 + 4 * 8);
+
+ArmCortex::IrqTrace::Buffer<64> test_trace;
+
+extern "C" void traced_handler_body();
+
+// Test traced() - IPSR read once, entry event, handler call, exit event
+extern "C" void test_irq_trace_traced() {
+    ArmCortex::IrqTrace::traced<test_trace, &traced_handler_body>();
+}
+
+// CHECK-LABEL: <test_irq_trace_traced>:
+// CHECK: mrs {{r[0-9]+}}, IPSR
+// CHECK-NOT: mrs {{r[0-9]+}}, IPSR
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: ldrex
+// CHECK: strex
+// CHECK: {{bl }}
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: ldrex
+// CHECK: strex
+
+// Test Buffer::record() - CYCCNT read inside the LDREX/STREX reservation loop, no library calls
+extern "C" void test_irq_trace_record(uint16_t exception) {
+    test_trace.record(ArmCortex::IrqTrace::EventKind::TRIGGER, exception);
+}
+
+// CHECK-LABEL: <test_irq_trace_record>:
+// CHECK-NOT: {{bl }}
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: ldrex
+// CHECK: strex
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
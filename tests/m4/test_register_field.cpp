@@ -0,0 +1,265 @@
+#include "armcortex/m4/dcb.hpp"
+#include "armcortex/m4/dwt.hpp"
+#include "armcortex/m4/itm.hpp"
+#include "armcortex/m4/mpu.hpp"
+#include "armcortex/m4/scb.hpp"
+#include "armcortex/m4/scnscb.hpp"
+#include "armcortex/m4/systick.hpp"
+
+using ArmCortex::Scb::AIRCR;
+using ArmCortex::Scb::ICSR;
+using ArmCortex::Scb::SCR;
+
+static_assert(SCR::SLEEPDEEP_FIELD.MASK == 0x00000004u);
+static_assert(AIRCR::PRIGROUP_FIELD.MASK == 0x00000700u);
+static_assert(ICSR::PENDSVSET_FIELD(1).bits == 0x10000000u);
+static_assert(AIRCR::PRIGROUP_FIELD.get(0xFA050500u) == 5u);
+
+using namespace ArmCortex;
+
+// Every field descriptor covers exactly the bits of its Bits member
+static_assert(matchesBitfield(Dcb::DHCSR::C_DEBUGEN_FIELD, [](auto& bits, uint32_t ones) { bits.C_DEBUGEN = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::C_HALT_FIELD, [](auto& bits, uint32_t ones) { bits.C_HALT = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::C_STEP_FIELD, [](auto& bits, uint32_t ones) { bits.C_STEP = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::C_MASKINTS_FIELD, [](auto& bits, uint32_t ones) { bits.C_MASKINTS = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::C_SNAPSTALL_FIELD, [](auto& bits, uint32_t ones) { bits.C_SNAPSTALL = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::S_REGRDY_FIELD, [](auto& bits, uint32_t ones) { bits.S_REGRDY = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::S_HALT_FIELD, [](auto& bits, uint32_t ones) { bits.S_HALT = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::S_SLEEP_FIELD, [](auto& bits, uint32_t ones) { bits.S_SLEEP = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::S_LOCKUP_FIELD, [](auto& bits, uint32_t ones) { bits.S_LOCKUP = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::S_RETIRE_ST_FIELD, [](auto& bits, uint32_t ones) { bits.S_RETIRE_ST = ones; }));
+static_assert(matchesBitfield(Dcb::DHCSR::S_RESET_ST_FIELD, [](auto& bits, uint32_t ones) { bits.S_RESET_ST = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_CORERESET_FIELD, [](auto& bits, uint32_t ones) { bits.VC_CORERESET = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_MMERR_FIELD, [](auto& bits, uint32_t ones) { bits.VC_MMERR = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_NOCPERR_FIELD, [](auto& bits, uint32_t ones) { bits.VC_NOCPERR = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_CHKERR_FIELD, [](auto& bits, uint32_t ones) { bits.VC_CHKERR = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_STATERR_FIELD, [](auto& bits, uint32_t ones) { bits.VC_STATERR = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_BUSERR_FIELD, [](auto& bits, uint32_t ones) { bits.VC_BUSERR = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_INTERR_FIELD, [](auto& bits, uint32_t ones) { bits.VC_INTERR = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::VC_HARDERR_FIELD, [](auto& bits, uint32_t ones) { bits.VC_HARDERR = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::MON_EN_FIELD, [](auto& bits, uint32_t ones) { bits.MON_EN = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::MON_PEND_FIELD, [](auto& bits, uint32_t ones) { bits.MON_PEND = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::MON_STEP_FIELD, [](auto& bits, uint32_t ones) { bits.MON_STEP = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::MON_REQ_FIELD, [](auto& bits, uint32_t ones) { bits.MON_REQ = ones; }));
+static_assert(matchesBitfield(Dcb::DEMCR::TRCENA_FIELD, [](auto& bits, uint32_t ones) { bits.TRCENA = ones; }));
+
+static_assert(matchesBitfield(Dwt::CTRL::CYCCNTENA_FIELD, [](auto& bits, uint32_t ones) { bits.CYCCNTENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::POSTPRESET_FIELD, [](auto& bits, uint32_t ones) { bits.POSTPRESET = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::POSTINIT_FIELD, [](auto& bits, uint32_t ones) { bits.POSTINIT = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::CYCTAP_FIELD, [](auto& bits, uint32_t ones) { bits.CYCTAP = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::SYNCTAP_FIELD, [](auto& bits, uint32_t ones) { bits.SYNCTAP = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::PCSAMPLENA_FIELD, [](auto& bits, uint32_t ones) { bits.PCSAMPLENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::EXCTRCENA_FIELD, [](auto& bits, uint32_t ones) { bits.EXCTRCENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::CPIEVTENA_FIELD, [](auto& bits, uint32_t ones) { bits.CPIEVTENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::EXCEVTENA_FIELD, [](auto& bits, uint32_t ones) { bits.EXCEVTENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::SLEEPEVTENA_FIELD, [](auto& bits, uint32_t ones) { bits.SLEEPEVTENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::LSUEVTENA_FIELD, [](auto& bits, uint32_t ones) { bits.LSUEVTENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::FOLDEVTENA_FIELD, [](auto& bits, uint32_t ones) { bits.FOLDEVTENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::CYCEVTENA_FIELD, [](auto& bits, uint32_t ones) { bits.CYCEVTENA = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::NOPRFCNT_FIELD, [](auto& bits, uint32_t ones) { bits.NOPRFCNT = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::NOCYCCNT_FIELD, [](auto& bits, uint32_t ones) { bits.NOCYCCNT = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::NOEXTTRIG_FIELD, [](auto& bits, uint32_t ones) { bits.NOEXTTRIG = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::NOTRCPKT_FIELD, [](auto& bits, uint32_t ones) { bits.NOTRCPKT = ones; }));
+static_assert(matchesBitfield(Dwt::CTRL::NUMCOMP_FIELD, [](auto& bits, uint32_t ones) { bits.NUMCOMP = ones; }));
+static_assert(matchesBitfield(Dwt::MASK::MASK_FIELD, [](auto& bits, uint32_t ones) { bits.MASK = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::FUNCTION_FIELD, [](auto& bits, uint32_t ones) { bits.FUNCTION = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::EMITRANGE_FIELD, [](auto& bits, uint32_t ones) { bits.EMITRANGE = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::CYCMATCH_FIELD, [](auto& bits, uint32_t ones) { bits.CYCMATCH = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::DATAVMATCH_FIELD, [](auto& bits, uint32_t ones) { bits.DATAVMATCH = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::LNK1ENA_FIELD, [](auto& bits, uint32_t ones) { bits.LNK1ENA = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::DATAVSIZE_FIELD, [](auto& bits, uint32_t ones) { bits.DATAVSIZE = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::DATAVADDR0_FIELD, [](auto& bits, uint32_t ones) { bits.DATAVADDR0 = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::DATAVADDR1_FIELD, [](auto& bits, uint32_t ones) { bits.DATAVADDR1 = ones; }));
+static_assert(matchesBitfield(Dwt::FUNCTION::MATCHED_FIELD, [](auto& bits, uint32_t ones) { bits.MATCHED = ones; }));
+
+static_assert(matchesBitfield(Itm::TCR::ITMENA_FIELD, [](auto& bits, uint32_t ones) { bits.ITMENA = ones; }));
+static_assert(matchesBitfield(Itm::TCR::TSENA_FIELD, [](auto& bits, uint32_t ones) { bits.TSENA = ones; }));
+static_assert(matchesBitfield(Itm::TCR::SYNCENA_FIELD, [](auto& bits, uint32_t ones) { bits.SYNCENA = ones; }));
+static_assert(matchesBitfield(Itm::TCR::TXENA_FIELD, [](auto& bits, uint32_t ones) { bits.TXENA = ones; }));
+static_assert(matchesBitfield(Itm::TCR::SWOENA_FIELD, [](auto& bits, uint32_t ones) { bits.SWOENA = ones; }));
+static_assert(matchesBitfield(Itm::TCR::TSPRESCALE_FIELD, [](auto& bits, uint32_t ones) { bits.TSPRESCALE = ones; }));
+static_assert(matchesBitfield(Itm::TCR::GTSFREQ_FIELD, [](auto& bits, uint32_t ones) { bits.GTSFREQ = ones; }));
+static_assert(matchesBitfield(Itm::TCR::TRACEBUSID_FIELD, [](auto& bits, uint32_t ones) { bits.TRACEBUSID = ones; }));
+static_assert(matchesBitfield(Itm::TCR::BUSY_FIELD, [](auto& bits, uint32_t ones) { bits.BUSY = ones; }));
+
+static_assert(matchesBitfield(Mpu::TYPE::SEPARATE_FIELD, [](auto& bits, uint32_t ones) { bits.SEPARATE = ones; }));
+static_assert(matchesBitfield(Mpu::TYPE::DREGION_FIELD, [](auto& bits, uint32_t ones) { bits.DREGION = ones; }));
+static_assert(matchesBitfield(Mpu::TYPE::IREGION_FIELD, [](auto& bits, uint32_t ones) { bits.IREGION = ones; }));
+static_assert(matchesBitfield(Mpu::CTRL::ENABLE_FIELD, [](auto& bits, uint32_t ones) { bits.ENABLE = ones; }));
+static_assert(matchesBitfield(Mpu::CTRL::HFNMIENA_FIELD, [](auto& bits, uint32_t ones) { bits.HFNMIENA = ones; }));
+static_assert(matchesBitfield(Mpu::CTRL::PRIVDEFENA_FIELD, [](auto& bits, uint32_t ones) { bits.PRIVDEFENA = ones; }));
+static_assert(matchesBitfield(Mpu::RBAR::REGION_FIELD, [](auto& bits, uint32_t ones) { bits.REGION = ones; }));
+static_assert(matchesBitfield(Mpu::RBAR::VALID_FIELD, [](auto& bits, uint32_t ones) { bits.VALID = ones; }));
+static_assert(matchesBitfield(Mpu::RBAR::ADDR_FIELD, [](auto& bits, uint32_t ones) { bits.ADDR = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::ENABLE_FIELD, [](auto& bits, uint32_t ones) { bits.ENABLE = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::SIZE_FIELD, [](auto& bits, uint32_t ones) { bits.SIZE = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::SRD_FIELD, [](auto& bits, uint32_t ones) { bits.SRD = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::B_FIELD, [](auto& bits, uint32_t ones) { bits.B = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::C_FIELD, [](auto& bits, uint32_t ones) { bits.C = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::S_FIELD, [](auto& bits, uint32_t ones) { bits.S = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::TEX_FIELD, [](auto& bits, uint32_t ones) { bits.TEX = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::AP_FIELD, [](auto& bits, uint32_t ones) { bits.AP = ones; }));
+static_assert(matchesBitfield(Mpu::RASR::XN_FIELD, [](auto& bits, uint32_t ones) { bits.XN = ones; }));
+
+static_assert(matchesBitfield(Scb::CPUID::REVISION_FIELD, [](auto& bits, uint32_t ones) { bits.REVISION = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::PARTNO_FIELD, [](auto& bits, uint32_t ones) { bits.PARTNO = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::ARCHITECTURE_FIELD, [](auto& bits, uint32_t ones) { bits.ARCHITECTURE = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::VARIANT_FIELD, [](auto& bits, uint32_t ones) { bits.VARIANT = ones; }));
+static_assert(matchesBitfield(Scb::CPUID::IMPLEMENTER_FIELD, [](auto& bits, uint32_t ones) { bits.IMPLEMENTER = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::VECTACTIVE_FIELD, [](auto& bits, uint32_t ones) { bits.VECTACTIVE = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::RETTOBASE_FIELD, [](auto& bits, uint32_t ones) { bits.RETTOBASE = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::VECTPENDING_FIELD, [](auto& bits, uint32_t ones) { bits.VECTPENDING = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::ISRPENDING_FIELD, [](auto& bits, uint32_t ones) { bits.ISRPENDING = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::ISRPREEMPT_FIELD, [](auto& bits, uint32_t ones) { bits.ISRPREEMPT = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSTCLR_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSTCLR = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSTSET_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSTSET = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSVCLR_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSVCLR = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::PENDSVSET_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSVSET = ones; }));
+static_assert(matchesBitfield(Scb::ICSR::NMIPENDSET_FIELD, [](auto& bits, uint32_t ones) { bits.NMIPENDSET = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::VECTRESET_FIELD, [](auto& bits, uint32_t ones) { bits.VECTRESET = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::VECTCLRACTIVE_FIELD, [](auto& bits, uint32_t ones) { bits.VECTCLRACTIVE = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::SYSRESETREQ_FIELD, [](auto& bits, uint32_t ones) { bits.SYSRESETREQ = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::PRIGROUP_FIELD, [](auto& bits, uint32_t ones) { bits.PRIGROUP = ones; }));
+static_assert(matchesBitfield(Scb::AIRCR::ENDIANNESS_FIELD, [](auto& bits, uint32_t ones) { bits.ENDIANNESS = ones; }));
+static_assert(matchesBitfield(Scb::SCR::SLEEPONEXIT_FIELD, [](auto& bits, uint32_t ones) { bits.SLEEPONEXIT = ones; }));
+static_assert(matchesBitfield(Scb::SCR::SLEEPDEEP_FIELD, [](auto& bits, uint32_t ones) { bits.SLEEPDEEP = ones; }));
+static_assert(matchesBitfield(Scb::SCR::SEVONPEND_FIELD, [](auto& bits, uint32_t ones) { bits.SEVONPEND = ones; }));
+static_assert(matchesBitfield(Scb::CCR::NONBASETHRDENA_FIELD, [](auto& bits, uint32_t ones) { bits.NONBASETHRDENA = ones; }));
+static_assert(matchesBitfield(Scb::CCR::USERSETMPEND_FIELD, [](auto& bits, uint32_t ones) { bits.USERSETMPEND = ones; }));
+static_assert(matchesBitfield(Scb::CCR::UNALIGN_TRP_FIELD, [](auto& bits, uint32_t ones) { bits.UNALIGN_TRP = ones; }));
+static_assert(matchesBitfield(Scb::CCR::DIV_0_TRP_FIELD, [](auto& bits, uint32_t ones) { bits.DIV_0_TRP = ones; }));
+static_assert(matchesBitfield(Scb::CCR::BFHFNMIGN_FIELD, [](auto& bits, uint32_t ones) { bits.BFHFNMIGN = ones; }));
+static_assert(matchesBitfield(Scb::CCR::STKALIGN_FIELD, [](auto& bits, uint32_t ones) { bits.STKALIGN = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::MEMFAULTACT_FIELD, [](auto& bits, uint32_t ones) { bits.MEMFAULTACT = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::BUSFAULTACT_FIELD, [](auto& bits, uint32_t ones) { bits.BUSFAULTACT = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::USGFAULTACT_FIELD, [](auto& bits, uint32_t ones) { bits.USGFAULTACT = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::SVCALLACT_FIELD, [](auto& bits, uint32_t ones) { bits.SVCALLACT = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::MONITORACT_FIELD, [](auto& bits, uint32_t ones) { bits.MONITORACT = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::PENDSVACT_FIELD, [](auto& bits, uint32_t ones) { bits.PENDSVACT = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::SYSTICKACT_FIELD, [](auto& bits, uint32_t ones) { bits.SYSTICKACT = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::USGFAULTPENDED_FIELD, [](auto& bits, uint32_t ones) { bits.USGFAULTPENDED = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::MEMFAULTPENDED_FIELD, [](auto& bits, uint32_t ones) { bits.MEMFAULTPENDED = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::BUSFAULTPENDED_FIELD, [](auto& bits, uint32_t ones) { bits.BUSFAULTPENDED = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::SVCALLPENDED_FIELD, [](auto& bits, uint32_t ones) { bits.SVCALLPENDED = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::MEMFAULTENA_FIELD, [](auto& bits, uint32_t ones) { bits.MEMFAULTENA = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::BUSFAULTENA_FIELD, [](auto& bits, uint32_t ones) { bits.BUSFAULTENA = ones; }));
+static_assert(matchesBitfield(Scb::SHCSR::USGFAULTENA_FIELD, [](auto& bits, uint32_t ones) { bits.USGFAULTENA = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::IACCVIOL_FIELD, [](auto& bits, uint32_t ones) { bits.IACCVIOL = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::DACCVIOL_FIELD, [](auto& bits, uint32_t ones) { bits.DACCVIOL = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::MUNSTKERR_FIELD, [](auto& bits, uint32_t ones) { bits.MUNSTKERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::MSTKERR_FIELD, [](auto& bits, uint32_t ones) { bits.MSTKERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::MLSPERR_FIELD, [](auto& bits, uint32_t ones) { bits.MLSPERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::MMARVALID_FIELD, [](auto& bits, uint32_t ones) { bits.MMARVALID = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::IBUSERR_FIELD, [](auto& bits, uint32_t ones) { bits.IBUSERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::PRECISERR_FIELD, [](auto& bits, uint32_t ones) { bits.PRECISERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::IMPRECISERR_FIELD, [](auto& bits, uint32_t ones) { bits.IMPRECISERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::UNSTKERR_FIELD, [](auto& bits, uint32_t ones) { bits.UNSTKERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::STKERR_FIELD, [](auto& bits, uint32_t ones) { bits.STKERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::LSPERR_FIELD, [](auto& bits, uint32_t ones) { bits.LSPERR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::BFARVALID_FIELD, [](auto& bits, uint32_t ones) { bits.BFARVALID = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::UNDEFINSTR_FIELD, [](auto& bits, uint32_t ones) { bits.UNDEFINSTR = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::INVSTATE_FIELD, [](auto& bits, uint32_t ones) { bits.INVSTATE = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::INVPC_FIELD, [](auto& bits, uint32_t ones) { bits.INVPC = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::NOCP_FIELD, [](auto& bits, uint32_t ones) { bits.NOCP = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::UNALIGNED_FIELD, [](auto& bits, uint32_t ones) { bits.UNALIGNED = ones; }));
+static_assert(matchesBitfield(Scb::CFSR::DIVBYZERO_FIELD, [](auto& bits, uint32_t ones) { bits.DIVBYZERO = ones; }));
+static_assert(matchesBitfield(Scb::HFSR::VECTTBL_FIELD, [](auto& bits, uint32_t ones) { bits.VECTTBL = ones; }));
+static_assert(matchesBitfield(Scb::HFSR::FORCED_FIELD, [](auto& bits, uint32_t ones) { bits.FORCED = ones; }));
+static_assert(matchesBitfield(Scb::HFSR::DEBUGEVT_FIELD, [](auto& bits, uint32_t ones) { bits.DEBUGEVT = ones; }));
+static_assert(matchesBitfield(Scb::DFSR::HALTED_FIELD, [](auto& bits, uint32_t ones) { bits.HALTED = ones; }));
+static_assert(matchesBitfield(Scb::DFSR::BKPT_FIELD, [](auto& bits, uint32_t ones) { bits.BKPT = ones; }));
+static_assert(matchesBitfield(Scb::DFSR::DWTTRAP_FIELD, [](auto& bits, uint32_t ones) { bits.DWTTRAP = ones; }));
+static_assert(matchesBitfield(Scb::DFSR::VCATCH_FIELD, [](auto& bits, uint32_t ones) { bits.VCATCH = ones; }));
+static_assert(matchesBitfield(Scb::DFSR::EXTERNAL_FIELD, [](auto& bits, uint32_t ones) { bits.EXTERNAL = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP0_FIELD, [](auto& bits, uint32_t ones) { bits.CP0 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP1_FIELD, [](auto& bits, uint32_t ones) { bits.CP1 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP2_FIELD, [](auto& bits, uint32_t ones) { bits.CP2 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP3_FIELD, [](auto& bits, uint32_t ones) { bits.CP3 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP4_FIELD, [](auto& bits, uint32_t ones) { bits.CP4 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP5_FIELD, [](auto& bits, uint32_t ones) { bits.CP5 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP6_FIELD, [](auto& bits, uint32_t ones) { bits.CP6 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP7_FIELD, [](auto& bits, uint32_t ones) { bits.CP7 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP10_FIELD, [](auto& bits, uint32_t ones) { bits.CP10 = ones; }));
+static_assert(matchesBitfield(Scb::CPACR::CP11_FIELD, [](auto& bits, uint32_t ones) { bits.CP11 = ones; }));
+
+static_assert(matchesBitfield(ScnScb::ICTR::INTLINESNUM_FIELD, [](auto& bits, uint32_t ones) { bits.INTLINESNUM = ones; }));
+static_assert(matchesBitfield(ScnScb::ACTLR::DISMCYCINT_FIELD, [](auto& bits, uint32_t ones) { bits.DISMCYCINT = ones; }));
+static_assert(matchesBitfield(ScnScb::ACTLR::DISDEFWBUF_FIELD, [](auto& bits, uint32_t ones) { bits.DISDEFWBUF = ones; }));
+static_assert(matchesBitfield(ScnScb::ACTLR::DISFOLD_FIELD, [](auto& bits, uint32_t ones) { bits.DISFOLD = ones; }));
+static_assert(matchesBitfield(ScnScb::ACTLR::DISFPCA_FIELD, [](auto& bits, uint32_t ones) { bits.DISFPCA = ones; }));
+static_assert(matchesBitfield(ScnScb::ACTLR::DISOOFP_FIELD, [](auto& bits, uint32_t ones) { bits.DISOOFP = ones; }));
+
+static_assert(matchesBitfield(SysTick::CTRL::ENABLE_FIELD, [](auto& bits, uint32_t ones) { bits.ENABLE = ones; }));
+static_assert(matchesBitfield(SysTick::CTRL::TICKINT_FIELD, [](auto& bits, uint32_t ones) { bits.TICKINT = ones; }));
+static_assert(matchesBitfield(SysTick::CTRL::CLKSOURCE_FIELD, [](auto& bits, uint32_t ones) { bits.CLKSOURCE = ones; }));
+static_assert(matchesBitfield(SysTick::CTRL::COUNTFLAG_FIELD, [](auto& bits, uint32_t ones) { bits.COUNTFLAG = ones; }));
+static_assert(matchesBitfield(SysTick::CALIB::TENMS_FIELD, [](auto& bits, uint32_t ones) { bits.TENMS = ones; }));
+static_assert(matchesBitfield(SysTick::CALIB::SKEW_FIELD, [](auto& bits, uint32_t ones) { bits.SKEW = ones; }));
+static_assert(matchesBitfield(SysTick::CALIB::NOREF_FIELD, [](auto& bits, uint32_t ones) { bits.NOREF = ones; }));
+
+// Test modify() - three SCR fields updated with a single load and store
+extern "C" void test_modify_scr() {
+    ArmCortex::modify<SCR>(ArmCortex::SCB->SCR, SCR::SLEEPDEEP_FIELD(1), SCR::SLEEPONEXIT_FIELD(1), SCR::SEVONPEND_FIELD(0));
+}
+
+// CHECK-LABEL: <test_modify_scr>:
+// CHECK: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK-NOT: str
+// CHECK: str r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK-NOT: {{ldr|str}} r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK: bx lr
+
+// Reference: the same update as three single-field read-modify-write sequences
+extern "C" void test_separate_bitfield_updates_scr() {
+    SCR sleep_deep { ArmCortex::SCB->SCR };
+    sleep_deep.bits.SLEEPDEEP = 1;
+    ArmCortex::SCB->SCR = sleep_deep.value;
+
+    SCR sleep_on_exit { ArmCortex::SCB->SCR };
+    sleep_on_exit.bits.SLEEPONEXIT = 1;
+    ArmCortex::SCB->SCR = sleep_on_exit.value;
+
+    SCR sev_on_pend { ArmCortex::SCB->SCR };
+    sev_on_pend.bits.SEVONPEND = 0;
+    ArmCortex::SCB->SCR = sev_on_pend.value;
+}
+
+// CHECK-LABEL: <test_separate_bitfield_updates_scr>:
+// CHECK-COUNT-3: str r{{[0-9]+}}, [r{{[0-9]+}}, #16]
+// CHECK: bx lr
+
+// modify() on AIRCR - VECTKEY replaces the VECTKEYSTAT read back in bits [31:16], other bits are kept
+static_assert(ArmCortex::WRITE_KEY_OF<AIRCR> == 0x05FA0000u && ArmCortex::WRITE_KEY_MASK_OF<AIRCR> == 0xFFFF0000u);
+static_assert(ArmCortex::modifiedValue<AIRCR>(0xFA058000u, AIRCR::PRIGROUP_FIELD(3)) == 0x05FA8300u);
+
+// Test modify() on AIRCR - a single load and store, the key value is checked by the static_assert above
+extern "C" void test_modify_aircr_prigroup() {
+    ArmCortex::modify<AIRCR>(ArmCortex::SCB->AIRCR, AIRCR::PRIGROUP_FIELD(3));
+}
+
+// CHECK-LABEL: <test_modify_aircr_prigroup>:
+// CHECK: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #12]
+// CHECK: str r{{[0-9]+}}, [r{{[0-9]+}}, #12]
+// CHECK-NOT: {{ldr|str}} r{{[0-9]+}}, [r{{[0-9]+}}, #12]
+// CHECK: bx lr
+
+// Test write() on ICSR - W1S bit written without reading the register
+extern "C" void test_write_icsr_pendsvset() {
+    ArmCortex::write<ICSR>(ArmCortex::SCB->ICSR, ICSR::PENDSVSET_FIELD(1));
+}
+
+// CHECK-LABEL: <test_write_icsr_pendsvset>:
+// CHECK-NOT: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #4]
+// CHECK: str r{{[0-9]+}}, [r{{[0-9]+}}, #4]
+// CHECK-NOT: ldr r{{[0-9]+}}, [r{{[0-9]+}}, #4]
+// CHECK: bx lr
+
+// Test read() - single field extract
+extern "C" uint32_t test_read_aircr_prigroup() {
+    return ArmCortex::read<AIRCR>(ArmCortex::SCB->AIRCR, AIRCR::PRIGROUP_FIELD);
+}
+
+// CHECK-LABEL: <test_read_aircr_prigroup>:
+// CHECK: ldr r0, [r{{[0-9]+}}, #12]
+// CHECK-NEXT: ubfx r0, r0, #8, #3
+// CHECK: bx lr
@@ -0,0 +1,44 @@
+#include "armcortex/m4/scnscb.hpp"
+
+// Test reading ICTR register
+extern "C" [[gnu::naked]] auto test_read_ictr() {
+    return ArmCortex::ScnScb::ICTR(ArmCortex::SCN_SCB->ICTR);
+}
+
+// CHECK-LABEL: <test_read_ictr>:
+// CHECK-NEXT: mov.w r3, #3758153728
+// CHECK-NEXT: ldr r0, [r3, #4]
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+// Test getNumOfIrqLines() - (INTLINESNUM + 1) * 32
+extern "C" uint32_t test_get_num_of_irq_lines() {
+    return ArmCortex::ScnScb::getNumOfIrqLines();
+}
+
+// CHECK-LABEL: <test_get_num_of_irq_lines>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK-NOT: ldr
+// CHECK: {{lsls|adds|add.w}}
+
+// Test reading ACTLR register
+extern "C" [[gnu::naked]] auto test_read_actlr() {
+    return ArmCortex::ScnScb::ACTLR(ArmCortex::SCN_SCB->ACTLR);
+}
+
+// CHECK-LABEL: <test_read_actlr>:
+// CHECK-NEXT: mov.w r3, #3758153728
+// CHECK-NEXT: ldr r0, [r3, #8]
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+// Test modify() on ACTLR - DISDEFWBUF set for precise BusFaults, other bits kept
+extern "C" void test_modify_actlr_disdefwbuf() {
+    ArmCortex::modify<ArmCortex::ScnScb::ACTLR>(ArmCortex::SCN_SCB->ACTLR, ArmCortex::ScnScb::ACTLR::DISDEFWBUF_FIELD(1));
+}
+
+// CHECK-LABEL: <test_modify_actlr_disdefwbuf>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #8]
+// CHECK: orr.w {{r[0-9]+}}, {{r[0-9]+}}, #2
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #8]
+// CHECK: bx lr
@@ -0,0 +1,138 @@
+#include "armcortex/m7/cache.hpp"
+#include <cstddef>
+
+static_assert(offsetof(ArmCortex::Scb::Registers, CLIDR) == 0x78);
+static_assert(offsetof(ArmCortex::Scb::Registers, CCSIDR) == 0x80);
+static_assert(offsetof(ArmCortex::Scb::Registers, CSSELR) == 0x84);
+static_assert(offsetof(ArmCortex::Scb::Registers, CPACR) == 0x88);
+static_assert(offsetof(ArmCortex::Scb::Registers, STIR) == 0x200);
+static_assert(offsetof(ArmCortex::Scb::Registers, ICIALLU) == 0x250);
+static_assert(offsetof(ArmCortex::Scb::Registers, DCIMVAC) == 0x25C);
+static_assert(offsetof(ArmCortex::Scb::Registers, DCCMVAC) == 0x268);
+static_assert(offsetof(ArmCortex::Scb::Registers, DCCIMVAC) == 0x270);
+static_assert(offsetof(ArmCortex::Scb::Registers, BPIALL) == 0x278);
+static_assert(ArmCortex::Scb::CCR::DC_FIELD.MASK == 0x00010000u);
+static_assert(ArmCortex::Scb::CCR::IC_FIELD.MASK == 0x00020000u);
+static_assert(ArmCortex::Scb::CCSIDR::NUMSETS_FIELD.get(0xF00FE019u) == 0x7Fu);
+static_assert(ArmCortex::Cache::roundUpToLine(1) == 32u);
+static_assert(ArmCortex::Cache::roundUpToLine(64) == 64u);
+static_assert(ArmCortex::Cache::isLineAligned(0x20000040u));
+static_assert(!ArmCortex::Cache::isLineAligned(0x20000044u));
+
+// Test invalidateICache() - ICIALLU (offset 0x250) written between barriers
+extern "C" void test_invalidate_icache() {
+    ArmCortex::Cache::invalidateICache();
+}
+
+// CHECK-LABEL: <test_invalidate_icache>:
+// CHECK: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: str{{.*}}, #592]
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: bx lr
+
+// Test enableICache() - skipped when CCR.IC is set, otherwise invalidate then set CCR.IC (bit 17)
+extern "C" void test_enable_icache() {
+    ArmCortex::Cache::enableICache();
+}
+
+// CHECK-LABEL: <test_enable_icache>:
+// CHECK: ldr{{.*}}, #20]
+// CHECK: str{{.*}}, #592]
+// CHECK: orr{{.*}}, #131072
+// CHECK: str{{.*}}, #20]
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test enableDCache() - invalidate by set/way (DCISW, offset 0x260), then set CCR.DC (bit 16)
+extern "C" void test_enable_dcache() {
+    ArmCortex::Cache::enableDCache();
+}
+
+// CHECK-LABEL: <test_enable_dcache>:
+// CHECK: ldr{{.*}}, #20]
+// CHECK: str{{.*}}, #132]
+// CHECK-NEXT: dsb sy
+// CHECK: ldr{{.*}}, #128]
+// CHECK: str{{.*}}, #608]
+// CHECK: orr{{.*}}, #65536
+// CHECK: str{{.*}}, #20]
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK-NOT: {{bl }}
+// CHECK: {{bx lr|pop .*pc}}
+
+// Test disableDCache() - clear CCR.DC first, then clean and invalidate by set/way (DCCISW, offset 0x274)
+extern "C" void test_disable_dcache() {
+    ArmCortex::Cache::disableDCache();
+}
+
+// CHECK-LABEL: <test_disable_dcache>:
+// CHECK: dsb sy
+// CHECK: bic{{.*}}, #65536
+// CHECK: str{{.*}}, #20]
+// CHECK-NEXT: dsb sy
+// CHECK: str{{.*}}, #628]
+// CHECK: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK-NOT: {{bl }}
+// CHECK: {{bx lr|pop .*pc}}
+
+// Test cleanDCacheRange() - one DCCMVAC (offset 0x268) per line between barriers
+extern "C" void test_clean_dcache_range(const void* buffer, uint32_t size) {
+    ArmCortex::Cache::cleanDCacheRange(buffer, size);
+}
+
+// CHECK-LABEL: <test_clean_dcache_range>:
+// CHECK: dsb sy
+// CHECK: bic{{.*}}, #31
+// CHECK: str{{.*}}, #616]
+// CHECK: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test cleanInvalidateDCacheRange() - one DCCIMVAC (offset 0x270) per line between barriers
+extern "C" void test_clean_invalidate_dcache_range(const void* buffer, uint32_t size) {
+    ArmCortex::Cache::cleanInvalidateDCacheRange(buffer, size);
+}
+
+// CHECK-LABEL: <test_clean_invalidate_dcache_range>:
+// CHECK: dsb sy
+// CHECK: str{{.*}}, #624]
+// CHECK: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test invalidateDCacheRange() - partial lines at both ends cleaned and invalidated (DCCIMVAC),
+// whole lines only invalidated (DCIMVAC, offset 0x25C)
+extern "C" void test_invalidate_dcache_range(void* buffer, uint32_t size) {
+    ArmCortex::Cache::invalidateDCacheRange(buffer, size);
+}
+
+// CHECK-LABEL: <test_invalidate_dcache_range>:
+// CHECK: dsb sy
+// CHECK: str{{.*}}, #624]
+// CHECK: str{{.*}}, #604]
+// CHECK: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test invalidateDCacheRange() on a buffer declared for DMA - whole lines invalidated with DCIMVAC
+alignas(ArmCortex::Cache::LINE_SIZE) static uint8_t s_dma_buffer[ArmCortex::Cache::roundUpToLine(100)];
+
+extern "C" void test_invalidate_aligned_dma_buffer() {
+    ArmCortex::Cache::invalidateDCacheRange(s_dma_buffer, sizeof(s_dma_buffer));
+}
+
+// CHECK-LABEL: <test_invalidate_aligned_dma_buffer>:
+// CHECK: dsb sy
+// CHECK: str{{.*}}, #604]
+// CHECK: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: bx lr
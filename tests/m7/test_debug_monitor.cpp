@@ -0,0 +1,43 @@
+#include "armcortex/m7/debug_monitor.hpp"
+
+ArmCortex::DebugMonitor::HitLog<8> test_log;
+
+// Test handlerEntry() - stack pointer selected from EXC_RETURN bit 2, then handle() with LR preserved
+extern "C" [[gnu::naked]] void test_debug_monitor_handler_entry() {
+    ArmCortex::DebugMonitor::handlerEntry<test_log>();
+}
+
+// CHECK-LABEL: <test_debug_monitor_handler_entry>:
+// CHECK-NEXT: movs r0, #4
+// CHECK-NEXT: mov r1, lr
+// CHECK-NEXT: tst r0, r1
+// CHECK-NEXT: beq.n
+// CHECK-NEXT: mrs r0, PSP
+// CHECK-NEXT: b.n
+// CHECK-NEXT: mrs r0, MSP
+// CHECK-NEXT: push {r4, lr}
+// CHECK-NEXT: bl
+// CHECK-NEXT: pop {r4, pc}
+// MAXSPEED-CHECK-NEXT: nop
+// CHECK-EMPTY:
+
+// Test handle() - DFSR read, comparator match flags collected, DFSR written back to clear the events
+extern "C" void test_debug_monitor_handle(ArmCortex::Svc::StackFrame* frame) {
+    ArmCortex::DebugMonitor::handle<test_log>(frame);
+}
+
+// CHECK-LABEL: <test_debug_monitor_handle>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #48]
+// CHECK-NOT: {{bl }}
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #48]
+
+// Test enable() - MON_EN and TRCENA set with a single DEMCR update
+extern "C" void test_debug_monitor_enable() {
+    ArmCortex::DebugMonitor::enable();
+}
+
+// CHECK-LABEL: <test_debug_monitor_enable>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #12]
+// CHECK-NOT: {{ldr|str}} {{r[0-9]+}}, [{{r[0-9]+}}, #12]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #12]
+// CHECK: bx lr
@@ -0,0 +1,143 @@
+#include "armcortex/m7/dwt.hpp"
+#include <cstddef>
+
+static_assert(offsetof(ArmCortex::Dcb::Registers, DEMCR) == 0x0C);
+static_assert(offsetof(ArmCortex::Dwt::Registers, PCSR) == 0x1C);
+static_assert(offsetof(ArmCortex::Dwt::Registers, COMPARATORS) == 0x20);
+static_assert(offsetof(ArmCortex::Dwt::Registers, LAR) == 0xFB0);
+static_assert(offsetof(ArmCortex::Dwt::Registers, LSR) == 0xFB4);
+static_assert(sizeof(ArmCortex::Dwt::Comparator) == 0x10);
+static_assert(ArmCortex::Dcb::DEMCR::TRCENA_FIELD.MASK == 0x01000000u);
+static_assert(ArmCortex::Dwt::CTRL::NUMCOMP_FIELD.get(0x40000000u) == 4u);
+
+// diff() - 8-bit counters wrap modulo 256, instruction count derived from the categories
+static_assert(ArmCortex::Dwt::diff({ 0xFFFFFFF0u, 250, 0, 0, 0, 0 }, { 0x00000100u, 4, 0, 0, 0, 0 }).cycles == 0x110u);
+static_assert(ArmCortex::Dwt::diff({ 0xFFFFFFF0u, 250, 0, 0, 0, 0 }, { 0x00000100u, 4, 0, 0, 0, 0 }).cpi == 10u);
+static_assert(ArmCortex::Dwt::diff({ 0, 0, 0, 0, 0, 0 }, { 100, 10, 12, 0, 20, 2 }).instructions() == 60u);
+
+// Test reading CYCCNT register (offset 0x04)
+extern "C" [[gnu::naked]] uint32_t test_read_cyccnt() {
+    return ArmCortex::Dwt::getCycleCount();
+}
+
+// CHECK-LABEL: <test_read_cyccnt>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #4]
+// CHECK-NEXT: .word 0xe0001000
+// CHECK-EMPTY:
+
+// Test reading CPICNT register (offset 0x08)
+extern "C" [[gnu::naked]] uint32_t test_read_cpicnt() {
+    return ArmCortex::DWT->CPICNT;
+}
+
+// CHECK-LABEL: <test_read_cpicnt>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #8]
+// CHECK-NEXT: .word 0xe0001000
+// CHECK-EMPTY:
+
+// Test reading FOLDCNT register (offset 0x18)
+extern "C" [[gnu::naked]] uint32_t test_read_foldcnt() {
+    return ArmCortex::DWT->FOLDCNT;
+}
+
+// CHECK-LABEL: <test_read_foldcnt>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #24]
+// CHECK-NEXT: .word 0xe0001000
+// CHECK-EMPTY:
+
+// Test reading DEMCR register (offset 0x0C)
+extern "C" [[gnu::naked]] auto test_read_demcr() {
+    return ArmCortex::Dcb::DEMCR(ArmCortex::DCB->DEMCR);
+}
+
+// CHECK-LABEL: <test_read_demcr>:
+// CHECK-NEXT: ldr r3, [pc, #0]
+// CHECK-NEXT: ldr r0, [r3, #12]
+// CHECK-NEXT: .word 0xe000edf0
+// CHECK-EMPTY:
+
+// Test enableCycleCounter() - DEMCR.TRCENA, then LAR unlock, then CYCCNT reset, then CTRL.CYCCNTENA
+extern "C" void test_enable_cycle_counter() {
+    ArmCortex::Dwt::enableCycleCounter();
+}
+
+// CHECK-LABEL: <test_enable_cycle_counter>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #12]
+// CHECK: orr.w {{r[0-9]+}}, {{r[0-9]+}}, #16777216
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #12]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #4016]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #0]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #0]
+// CHECK: bx lr
+
+extern "C" void measured_work();
+
+// Test CycleScope - CYCCNT read on both sides of the measured call, overhead subtracted after it
+extern "C" uint32_t test_cycle_scope() {
+    uint32_t cycles;
+    {
+        ArmCortex::Dwt::CycleScope scope(cycles);
+        measured_work();
+    }
+    return cycles;
+}
+
+// CHECK-LABEL: <test_cycle_scope>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: {{bl }}
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+
+// Test enablePerfCounters() - all five event enables set with a single CTRL update
+extern "C" void test_enable_perf_counters() {
+    ArmCortex::Dwt::enablePerfCounters();
+}
+
+// CHECK-LABEL: <test_enable_perf_counters>:
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #4016]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #24]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #0]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #0]
+// CHECK-NOT: [{{r[0-9]+}}, #0]
+// CHECK: bx lr
+
+// Test PerfCounters::capture() - CYCCNT and the five 8-bit counters read in order, no calls
+extern "C" ArmCortex::Dwt::PerfCounters test_perf_counters_capture() {
+    return ArmCortex::Dwt::PerfCounters::capture();
+}
+
+// CHECK-LABEL: <test_perf_counters_capture>:
+// CHECK-NOT: {{bl }}
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #8]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #12]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #16]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #20]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #24]
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test setDataWatchpoint() - comparator disabled, then COMP, MASK and FUNCTION written in order
+extern "C" void test_set_data_watchpoint(uintptr_t address) {
+    ArmCortex::Dwt::setDataWatchpoint(2, address, 4, ArmCortex::Dwt::Access::WRITE);
+}
+
+// CHECK-LABEL: <test_set_data_watchpoint>:
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #72]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #64]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #68]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #72]
+// CHECK: bx lr
+
+// Test isMatched() - single FUNCTION read, MATCHED is bit 24
+extern "C" bool test_is_matched() {
+    return ArmCortex::Dwt::isMatched(0);
+}
+
+// CHECK-LABEL: <test_is_matched>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #40]
+// CHECK-NOT: {{ldr|str}} {{r[0-9]+}}, [{{r[0-9]+}}, #40]
+// CHECK: bx lr
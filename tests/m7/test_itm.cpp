@@ -0,0 +1,57 @@
+#include "armcortex/m7/itm.hpp"
+#include <cstddef>
+
+static_assert(offsetof(ArmCortex::Itm::Registers, TER) == 0xE00);
+static_assert(offsetof(ArmCortex::Itm::Registers, TPR) == 0xE40);
+static_assert(offsetof(ArmCortex::Itm::Registers, TCR) == 0xE80);
+static_assert(offsetof(ArmCortex::Itm::Registers, LAR) == 0xFB0);
+
+// Test tryWrite() - FIFOREADY checked once, byte store, no waiting
+extern "C" bool test_itm_try_write_8(uint8_t value) {
+    return ArmCortex::Itm::tryWrite<uint8_t>(0, value);
+}
+
+// CHECK-LABEL: <test_itm_try_write_8>:
+// CHECK: mov.w {{r[0-9]+}}, #3758096384
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #0]
+// CHECK: strb {{r[0-9]+}}, [{{r[0-9]+}}, #0]
+// CHECK: bx lr
+
+// Test write() - ITMENA and TER checked before waiting for FIFOREADY, then word store
+extern "C" void test_itm_write_32(uint32_t value) {
+    ArmCortex::Itm::write<uint32_t>(1, value);
+}
+
+// CHECK-LABEL: <test_itm_write_32>:
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #3712]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #3584]
+// CHECK: ldr {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: str {{r[0-9]+}}, [{{r[0-9]+}}, #4]
+// CHECK: bx lr
+
+// Test log() - header and arguments written with interrupts disabled, no library calls
+extern "C" void test_itm_log(int32_t value) {
+    ArmCortex::Itm::log<"value=%d">(1, value);
+}
+
+// CHECK-LABEL: <test_itm_log>:
+// CHECK-NOT: {{bl }}
+// CHECK: mrs {{r[0-9]+}}, PRIMASK
+// CHECK: cpsid i
+// CHECK-NOT: {{bl }}
+// CHECK: msr PRIMASK, {{r[0-9]+}}
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test non-blocking log() - every word gated by FIFOREADY, no waiting loop with interrupts masked
+extern "C" bool test_itm_log_non_blocking(uint32_t value) {
+    return ArmCortex::Itm::log<"value=%u", false>(1, value);
+}
+
+// CHECK-LABEL: <test_itm_log_non_blocking>:
+// CHECK-NOT: {{bl }}
+// CHECK: cpsid i
+// CHECK-NOT: {{bl }}
+// CHECK: msr PRIMASK, {{r[0-9]+}}
+// CHECK-NOT: {{bl }}
+// CHECK: {{bx lr|pop .*pc}}
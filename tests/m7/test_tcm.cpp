@@ -0,0 +1,87 @@
+#include "armcortex/m7/tcm.hpp"
+#include "armcortex/m7/cache.hpp"
+#include <cstddef>
+
+extern "C" [[gnu::section(".itcm_text"), gnu::long_call, gnu::noinline]] void test_itcm_handler();
+
+static_assert(offsetof(ArmCortex::Scb::Registers, ITCMCR) == 0x290);
+static_assert(offsetof(ArmCortex::Scb::Registers, DTCMCR) == 0x294);
+static_assert(offsetof(ArmCortex::Scb::Registers, AHBPCR) == 0x298);
+static_assert(offsetof(ArmCortex::Scb::Registers, CACR) == 0x29C);
+static_assert(offsetof(ArmCortex::Scb::Registers, AHBSCR) == 0x2A0);
+static_assert(offsetof(ArmCortex::Scb::Registers, ABFSR) == 0x2A8);
+static_assert(ArmCortex::Tcm::sizeFromField(0b0000) == 0u);
+static_assert(ArmCortex::Tcm::sizeFromField(0b0011) == 4u * 1024u);
+static_assert(ArmCortex::Tcm::sizeFromField(0b1000) == 128u * 1024u);
+
+// Test reading ITCMCR register (offset 0x290)
+extern "C" [[gnu::naked]] auto test_read_itcmcr() {
+    return ArmCortex::Scb::TCMCR(ArmCortex::SCB->ITCMCR);
+}
+
+// CHECK-LABEL: <test_read_itcmcr>:
+// CHECK-NEXT: ldr r3, [pc, #4]
+// CHECK-NEXT: ldr.w r0, [r3, #656]
+// CHECK-NEXT: nop
+// CHECK-NEXT: .word 0xe000ed00
+// CHECK-EMPTY:
+
+// Test getDtcmSize() - SZ field of DTCMCR (offset 0x294)
+extern "C" uint32_t test_get_dtcm_size() {
+    return ArmCortex::Tcm::getDtcmSize();
+}
+
+// CHECK-LABEL: <test_get_dtcm_size>:
+// CHECK: ldr{{.*}}, #660]
+// CHECK-NOT: {{bl }}
+// CHECK: bx lr
+
+// Test enableDtcm() with read-modify-write for ECC - EN and RMW set, RETEN cleared, between barriers
+extern "C" void test_enable_dtcm_ecc() {
+    ArmCortex::Tcm::enableDtcm(true);
+}
+
+// CHECK-LABEL: <test_enable_dtcm_ecc>:
+// CHECK: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: ldr{{.*}}, #660]
+// CHECK-DAG: {{bic.*, #(4|7)$|bfc.*, #[02], #[13]$}}
+// CHECK-DAG: orr{{.*}}, #3
+// CHECK: str{{.*}}, #660]
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: bx lr
+
+// Test setForceWriteThrough() - CACR.FORCEWT (offset 0x29C, bit 2)
+extern "C" void test_force_write_through() {
+    ArmCortex::Cache::setForceWriteThrough(true);
+}
+
+// CHECK-LABEL: <test_force_write_through>:
+// CHECK: dsb sy
+// CHECK: ldr{{.*}}, #668]
+// CHECK: orr{{.*}}, #4
+// CHECK: str{{.*}}, #668]
+// CHECK-NEXT: dsb sy
+// CHECK-NEXT: isb sy
+// CHECK: bx lr
+
+// Test calling an ITCM function from flash - long_call loads the address instead of a BL
+extern "C" void test_call_itcm_handler() {
+    test_itcm_handler();
+}
+
+// CHECK-LABEL: <test_call_itcm_handler>:
+// CHECK-NOT: {{bl }}
+// CHECK: {{bx|blx}} {{r[0-9]+}}
+
+// Test placing a handler in ITCM - same instructions as in flash, emitted in the .itcm_text section
+// after all .text functions
+extern "C" [[gnu::section(".itcm_text"), gnu::long_call, gnu::noinline]] void test_itcm_handler() {
+    ArmCortex::SCB->ICSR = uint32_t{1} << 25;
+}
+
+// CHECK-LABEL: Disassembly of section .itcm_text:
+// CHECK: <test_itcm_handler>:
+// CHECK: str{{.*}}, #4]
+// CHECK: bx lr
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+# Licensed under the Apache Licence, Version 2.0 (the "Licence");
+# you may not use this file except in compliance with the Licence.
+# You may obtain a copy of the Licence at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the Licence is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the Licence for the specific language governing permissions and
+# limitations under the Licence.
+
+"""Analyse an ArmCortex::IrqTrace::Buffer from a raw memory dump.
+
+The dump may contain other data, the buffer is located by its magic word. Reports per
+exception number: execution time (excluding nested handlers), trigger-to-entry latency,
+entry-to-entry period and its jitter, maximum preemption nesting, and a jitter histogram.
+
+Example (dump taken with GDB: dump binary value irq.bin irq_trace):
+    irq_trace.py --clock-hz 48000000 irq.bin
+"""
+
+import argparse
+import statistics
+import struct
+
+MAGIC = 0x54515249
+UNKNOWN_TIMER_PERIOD = 0xFFFFFFFF
+HEADER = struct.Struct("<IIII")
+EVENT = struct.Struct("<IHH")
+ENTRY, EXIT, TRIGGER = 0, 1, 2
+HISTOGRAM_WIDTH = 40
+
+
+def load_events(dump, offset):
+    """Return (timer period, events oldest first) of the buffer at offset."""
+    magic, capacity, timer_period, head = HEADER.unpack_from(dump, offset)
+    assert magic == MAGIC
+
+    if capacity == 0 or capacity & (capacity - 1):
+        raise ValueError(f"invalid buffer capacity {capacity} at offset 0x{offset:x}")
+
+    if timer_period == UNKNOWN_TIMER_PERIOD:
+        raise ValueError("SysTick period not recorded, call Buffer::reset() after configuring SysTick")
+
+    first = max(0, head - capacity)
+    events = []
+
+    for number in range(first, head):
+        position = offset + HEADER.size + (number % capacity) * EVENT.size
+        events.append(EVENT.unpack_from(dump, position))
+
+    return timer_period, events
+
+
+def elapsed(start, end, timer_period):
+    """Timer ticks from start to end, for the up-counting cycle counter or the down-counting SysTick."""
+    if timer_period == 0:
+        return (end - start) & 0xFFFFFFFF
+    return (start - end) % timer_period
+
+
+class Stats:
+    def __init__(self):
+        self.execution = []
+        self.latency = []
+        self.period = []
+        self.max_nesting = 0
+        self.last_entry = None
+        self.last_trigger = None
+
+
+def analyse(timer_period, events):
+    stats = {}
+    active = []  # Stack of [exception, entry timestamp, time spent in nested handlers].
+
+    for timestamp, exception, kind in events:
+        entry = stats.setdefault(exception, Stats())
+
+        if kind == TRIGGER:
+            entry.last_trigger = timestamp
+        elif kind == ENTRY:
+            if entry.last_entry is not None:
+                entry.period.append(elapsed(entry.last_entry, timestamp, timer_period))
+            if entry.last_trigger is not None:
+                entry.latency.append(elapsed(entry.last_trigger, timestamp, timer_period))
+                entry.last_trigger = None
+            entry.last_entry = timestamp
+            active.append([exception, timestamp, 0])
+            entry.max_nesting = max(entry.max_nesting, len(active))
+        elif kind == EXIT:
+            if not active or active[-1][0] != exception:
+                active.clear()  # Trace starts or was overwritten inside a handler.
+                continue
+            _, entry_timestamp, nested = active.pop()
+            duration = elapsed(entry_timestamp, timestamp, timer_period)
+            entry.execution.append(duration - nested)
+            if active:
+                active[-1][2] += duration
+
+    return stats
+
+
+def describe(values, scale, unit):
+    if not values:
+        return "-"
+    return (f"min {min(values) * scale:.2f} mean {statistics.fmean(values) * scale:.2f} "
+            f"max {max(values) * scale:.2f} {unit}")
+
+
+def histogram(values, bins):
+    low, high = min(values), max(values)
+    width = max(1, (high - low + bins) // bins)
+    counts = [0] * bins
+
+    for value in values:
+        counts[min(bins - 1, (value - low) // width)] += 1
+
+    peak = max(counts)
+    for index, count in enumerate(counts):
+        bar = "#" * max(1 if count else 0, count * HISTOGRAM_WIDTH // peak)
+        print(f"      {low + index * width:>10} .. {low + (index + 1) * width - 1:>10} | {count:>6} {bar}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="raw memory dump containing the trace buffer")
+    parser.add_argument("--clock-hz", type=float, help="timer clock, times are reported in microseconds when given")
+    parser.add_argument("--bins", type=int, default=10, help="number of jitter histogram bins")
+    options = parser.parse_args()
+
+    with open(options.dump, "rb") as dump_file:
+        dump = dump_file.read()
+
+    offset = dump.find(struct.pack("<I", MAGIC))
+    if offset < 0:
+        raise SystemExit("no IRQ trace buffer found in the dump")
+
+    timer_period, events = load_events(dump, offset)
+    scale, unit = (1e6 / options.clock_hz, "us") if options.clock_hz else (1, "ticks")
+    print(f"{len(events)} events, {'SysTick period ' + str(timer_period) if timer_period else 'cycle counter'} timestamps")
+
+    for exception, entry in sorted(analyse(timer_period, events).items()):
+        print(f"exception {exception}: {len(entry.execution)} runs, max nesting {entry.max_nesting}")
+        print(f"    execution {describe(entry.execution, scale, unit)}")
+        print(f"    latency   {describe(entry.latency, scale, unit)}")
+        print(f"    period    {describe(entry.period, scale, unit)}")
+
+        if len(entry.period) > 1:
+            mean = statistics.fmean(entry.period)
+            jitter = [round(value - mean) for value in entry.period]
+            print(f"    jitter    stdev {statistics.pstdev(entry.period) * scale:.2f} {unit}, "
+                  f"peak-to-peak {(max(jitter) - min(jitter)) * scale:.2f} {unit}, histogram in ticks:")
+            histogram(jitter, options.bins)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2025 Matej Gomboc <https://github.com/MatejGomboc/ARMCortexM-CppLib>
+
+# Licensed under the Apache Licence, Version 2.0 (the "Licence");
+# you may not use this file except in compliance with the Licence.
+# You may obtain a copy of the Licence at
+
+#     http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the Licence is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the Licence for the specific language governing permissions and
+# limitations under the Licence.
+
+"""Decode a captured ITM (SWO) byte stream.
+
+Stimulus ports given with --text-port are printed as plain text, ports given with
+--log-port are decoded as tokenised messages written by ArmCortex::Itm::log(): a header
+word (argument count in bits [31:24], format string offset in bits [23:0]) followed by
+one word per argument. A one-byte packet on a log port or an overflow packet discards
+a partly received message. The format strings are read from the .itm_formats section
+of the firmware ELF file.
+
+Example (raw SWO capture from OpenOCD or a probe tool):
+    itm_decode.py --elf firmware.elf --log-port 1 --text-port 0 swo.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+FORMAT_SECTION = ".itm_formats"
+LOG_ID_MASK = 0x00FFFFFF
+CONVERSION = re.compile(r"%[-+ #0]*\d*(?:\.\d+)?([diuxXocfeEgG%])")
+
+
+def read_format_section(elf_path):
+    """Return the contents of the format string section of a 32-bit little-endian ELF file."""
+    with open(elf_path, "rb") as elf_file:
+        elf = elf_file.read()
+
+    if elf[:4] != b"\x7fELF" or elf[4] != 1 or elf[5] != 1:
+        raise ValueError(f"{elf_path}: not a 32-bit little-endian ELF file")
+
+    section_offset, = struct.unpack_from("<I", elf, 0x20)
+    section_size, section_count, names_index = struct.unpack_from("<HHH", elf, 0x2E)
+
+    def section_header(index):
+        return struct.unpack_from("<IIIIIIIIII", elf, section_offset + index * section_size)
+
+    names_offset = section_header(names_index)[4]
+
+    for index in range(section_count):
+        header = section_header(index)
+        name_end = elf.index(b"\0", names_offset + header[0])
+        name = elf[names_offset + header[0]:name_end].decode()
+
+        if name == FORMAT_SECTION:
+            return elf[header[4]:header[4] + header[5]]
+
+    raise ValueError(f"{elf_path}: no {FORMAT_SECTION} section, check the linker script")
+
+
+def format_message(formats, format_offset, words):
+    """Format a tokenised message with printf-style conversions applied to 32-bit words."""
+    if formats is None or format_offset >= len(formats):
+        return f"<unknown format 0x{format_offset:06x}> " + " ".join(f"0x{word:08x}" for word in words)
+
+    text = formats[format_offset:formats.index(b"\0", format_offset)].decode(errors="replace")
+    args = iter(words)
+
+    def convert(match):
+        kind = match.group(1)
+
+        if kind == "%":
+            return "%"
+
+        word = next(args, 0)
+        spec = match.group(0)
+
+        if kind in "di":
+            return spec % struct.unpack("<i", struct.pack("<I", word))[0]
+        if kind == "u":
+            return (spec[:-1] + "d") % word
+        if kind == "c":
+            return spec % chr(word & 0xFF)
+        if kind in "feEgG":
+            return spec % struct.unpack("<f", struct.pack("<I", word))[0]
+        return spec % word
+
+    return CONVERSION.sub(convert, text)
+
+
+def packets(stream):
+    """Yield (port, payload bytes) for every software source packet, None for an overflow packet."""
+    index = 0
+
+    while index < len(stream):
+        header = stream[index]
+        index += 1
+
+        if header in (0x00, 0x80):
+            continue  # Part of a synchronisation packet.
+
+        if header == 0x70:
+            yield None
+            continue
+
+        if header & 0x03 == 0:
+            # Timestamp or extension packet, payload bytes follow while the continuation bit is set.
+            if header & 0x80:
+                while index < len(stream) and stream[index] & 0x80:
+                    index += 1
+                index += 1
+            continue
+
+        size = {1: 1, 2: 2, 3: 4}[header & 0x03]
+        payload = stream[index:index + size]
+        index += size
+
+        if len(payload) < size:
+            break
+
+        if header & 0x04 == 0:
+            yield header >> 3, payload
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", help="raw ITM byte stream, '-' for stdin")
+    parser.add_argument("--elf", help="firmware ELF file with the .itm_formats section")
+    parser.add_argument("--log-port", type=int, action="append", default=[], help="stimulus port with tokenised messages")
+    parser.add_argument("--text-port", type=int, action="append", default=[], help="stimulus port with plain text")
+    options = parser.parse_args()
+
+    formats = read_format_section(options.elf) if options.elf else None
+
+    if options.capture == "-":
+        stream = sys.stdin.buffer.read()
+    else:
+        with open(options.capture, "rb") as capture_file:
+            stream = capture_file.read()
+
+    pending = {port: [] for port in options.log_port}
+
+    for packet in packets(stream):
+        if packet is None:
+            print("<ITM overflow, packets lost>")
+            for words in pending.values():
+                words.clear()  # A lost word would misalign every following message.
+            continue
+
+        port, payload = packet
+
+        if port in options.text_port:
+            sys.stdout.write(payload.decode(errors="replace"))
+        elif port in pending:
+            words = pending[port]
+
+            if len(payload) == 1:
+                # Resync packet sent after a non-blocking message was cut short.
+                if words:
+                    print(f"[{port}] <message truncated>")
+                words.clear()
+                continue
+
+            words.append(int.from_bytes(payload, "little"))
+
+            if len(words) == 1 + (words[0] >> 24):
+                print(f"[{port}] " + format_message(formats, words[0] & LOG_ID_MASK, words[1:]))
+                words.clear()
+
+
+if __name__ == "__main__":
+    main()